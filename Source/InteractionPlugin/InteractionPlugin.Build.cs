@@ -26,6 +26,7 @@ public class InteractionPlugin : ModuleRules
 			new string[]
 			{
 				"Core",
+				"GameplayTags",
 				// ... add other public dependencies that you statically link with here ...
 			}
 			);
@@ -36,6 +37,7 @@ public class InteractionPlugin : ModuleRules
 			{
 				"CoreUObject",
 				"Engine",
+				"NetCore",
 				"Slate",
 				"SlateCore",
 				// ... add private dependencies that you statically link with here ...	
@@ -43,6 +45,11 @@ public class InteractionPlugin : ModuleRules
 			);
 		
 		
+		// Enable Iris replication support on engine versions providing it
+#if UE_5_1_OR_LATER
+		SetupIrisSupport(Target);
+#endif
+
 		DynamicallyLoadedModuleNames.AddRange(
 			new string[]
 			{
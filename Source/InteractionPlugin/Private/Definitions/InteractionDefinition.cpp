@@ -0,0 +1,21 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "InteractionDefinition.h"
+
+const FPrimaryAssetType UInteractionDefinition::PrimaryAssetType = TEXT("InteractionDefinition");
+
+UInteractionDefinition::UInteractionDefinition()
+	:InteractionStateNetMode(EInteractionNetMode::INM_OwnerOnly)
+	,bMultipleInteraction(true)
+	,bOnlyFaceInteraction(false)
+	,InteractionDuration(10.0f)
+	,bQueueInteractors(false)
+	,MaxQueuedInteractors(4)
+	,QueueOrder(EInteractionQueueOrder::IQO_FIFO)
+{
+}
+
+FPrimaryAssetId UInteractionDefinition::GetPrimaryAssetId() const
+{
+	return FPrimaryAssetId(PrimaryAssetType, GetFName());
+}
@@ -0,0 +1,365 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "InteractionTagIndex.h"
+#include "InteractionComponents/InteractionComponent.h"
+
+void FInteractionTagIndex::SetCellSize(float NewCellSize)
+{
+	if (NumInteractions == 0 && NewCellSize > 0.0f)
+	{
+		CellSize = NewCellSize;
+	}
+}
+
+void FInteractionTagIndex::Add(UInteractionComponent* InteractionComponent)
+{
+	Remove(InteractionComponent);
+
+	if (!IsValid(InteractionComponent) || InteractionComponent->InteractionTags.IsEmpty())
+	{
+		return;
+	}
+
+	const FInteractionTagMask Mask = CompileInteractionTags(InteractionComponent->InteractionTags);
+	const int32 NumItems = InteractionComponent->GetNumInteractionItems();
+
+	TArray<FSlot>& InteractionSlots = Slots.Add(InteractionComponent);
+
+	if (NumItems <= 0)
+	{
+		InteractionSlots.Add(AddEntry(InteractionComponent, INDEX_NONE, Mask, InteractionComponent->GetInteractionLocation()));
+		return;
+	}
+
+	InteractionSlots.Reserve(NumItems);
+
+	for (int32 Item = 0; Item < NumItems; ++Item)
+	{
+		InteractionSlots.Add(AddEntry(InteractionComponent, Item, Mask, InteractionComponent->GetInteractionLocation(Item)));
+	}
+}
+
+void FInteractionTagIndex::Move(UInteractionComponent* InteractionComponent)
+{
+	TArray<FSlot>* InteractionSlots = Slots.Find(InteractionComponent);
+	if (InteractionSlots == nullptr)
+	{
+		return;
+	}
+
+	/* Items Were Added or Removed, Index the Interaction Again */
+	const int32 NumItems = InteractionComponent->GetNumInteractionItems();
+	if (InteractionSlots->Num() != FMath::Max(NumItems, 1))
+	{
+		Add(InteractionComponent);
+		return;
+	}
+
+	TSet<FIntPoint> TouchedCells;
+
+	for (int32 SlotIndex = 0; SlotIndex < InteractionSlots->Num(); ++SlotIndex)
+	{
+		const int32 Item = NumItems > 0 ? SlotIndex : INDEX_NONE;
+		const FVector Location = InteractionComponent->GetInteractionLocation(Item);
+
+		/* Removing Entries Fixes Up Other Slots of this Interaction, Read the Slot Again Each Time */
+		const FSlot Slot = (*InteractionSlots)[SlotIndex];
+		FCell& Cell = Cells.FindChecked(Slot.Cell);
+
+		if (GetCell(Location) == Slot.Cell)
+		{
+			Cell.Locations[Slot.Index] = Location;
+			continue;
+		}
+
+		const FInteractionTagMask Mask = Cell.Masks[Slot.Index];
+
+		RemoveEntry(Slot);
+		TouchedCells.Add(Slot.Cell);
+
+		(*InteractionSlots)[SlotIndex] = AddEntry(InteractionComponent, Item, Mask, Location);
+	}
+
+	RecomputeUnions(TouchedCells);
+}
+
+void FInteractionTagIndex::Remove(const UInteractionComponent* InteractionComponent)
+{
+	TArray<FSlot>* InteractionSlots = Slots.Find(InteractionComponent);
+	if (InteractionSlots == nullptr)
+	{
+		return;
+	}
+
+	/* Removing Entries Fixes Up Other Slots of this Interaction, Keep the Slots Mapped Until Done */
+	TSet<FIntPoint> TouchedCells;
+
+	for (int32 SlotIndex = 0; SlotIndex < InteractionSlots->Num(); ++SlotIndex)
+	{
+		const FSlot Slot = (*InteractionSlots)[SlotIndex];
+
+		RemoveEntry(Slot);
+		TouchedCells.Add(Slot.Cell);
+	}
+
+	Slots.Remove(InteractionComponent);
+
+	/* Once per Cell Rather Than per Removed Item */
+	RecomputeUnions(TouchedCells);
+}
+
+FInteractionTagIndex::FSlot FInteractionTagIndex::AddEntry(UInteractionComponent* InteractionComponent, int32 Item, const FInteractionTagMask& Mask, const FVector& Location)
+{
+	const FIntPoint CellCoord = GetCell(Location);
+	FCell& Cell = Cells.FindOrAdd(CellCoord);
+
+	const int32 Index = Cell.Masks.Add(Mask);
+	Cell.Locations.Add(Location);
+	Cell.Components.Add(InteractionComponent);
+	Cell.Items.Add(Item);
+	Cell.Union |= Mask;
+
+	++NumInteractions;
+
+	return { CellCoord, Index };
+}
+
+void FInteractionTagIndex::RemoveEntry(const FSlot& Slot)
+{
+	FCell* Cell = Cells.Find(Slot.Cell);
+	if (Cell == nullptr || !Cell->Components.IsValidIndex(Slot.Index))
+	{
+		return;
+	}
+
+	--NumInteractions;
+
+	Cell->Masks.RemoveAtSwap(Slot.Index, 1, false);
+	Cell->Locations.RemoveAtSwap(Slot.Index, 1, false);
+	Cell->Components.RemoveAtSwap(Slot.Index, 1, false);
+	Cell->Items.RemoveAtSwap(Slot.Index, 1, false);
+
+	if (Cell->Components.Num() == 0)
+	{
+		Cells.Remove(Slot.Cell);
+		return;
+	}
+
+	/* Fix Up the Slot of the Entry Swapped Into the Removed Index */
+	if (Cell->Components.IsValidIndex(Slot.Index))
+	{
+		Slots.FindChecked(Cell->Components[Slot.Index])[GetSlotIndex(Cell->Items[Slot.Index])].Index = Slot.Index;
+	}
+}
+
+void FInteractionTagIndex::RecomputeUnions(const TSet<FIntPoint>& TouchedCells)
+{
+	for (const FIntPoint& CellCoord : TouchedCells)
+	{
+		FCell* Cell = Cells.Find(CellCoord);
+		if (Cell == nullptr)
+		{
+			continue;
+		}
+
+		/* Removed Bits May No Longer be in the Cell */
+		Cell->Union = FInteractionTagMask();
+
+		for (const FInteractionTagMask& Mask : Cell->Masks)
+		{
+			Cell->Union |= Mask;
+		}
+	}
+}
+
+void FInteractionTagIndex::Query(const FVector& Center, float Radius, const FGameplayTagContainer& RequiredTags, const FGameplayTagContainer& BlockedTags, TArray<UInteractionComponent*>& OutInteractions, TArray<int32>* OutItems /* = nullptr */) const
+{
+	if (Cells.Num() == 0)
+	{
+		return;
+	}
+
+	FInteractionTagMask RequiredMask;
+	FInteractionTagMask BlockedMask;
+	bool bExactRequired = false;
+	bool bExactBlocked = false;
+
+	/* A Required Tag No Interaction Has, Nothing Can Match */
+	if (!CompileQueryTags(RequiredTags, RequiredMask, bExactRequired) && !bTagBitsExhausted)
+	{
+		return;
+	}
+
+	CompileQueryTags(BlockedTags, BlockedMask, bExactBlocked);
+
+	/* Tags Left Without a Bit are Verified Against the Component Tags of the Candidates Only */
+	const FGameplayTagContainer* ExactRequiredTags = bExactRequired ? &RequiredTags : nullptr;
+	const FGameplayTagContainer* ExactBlockedTags = bExactBlocked ? &BlockedTags : nullptr;
+
+	const float RadiusSquared = FMath::Square(Radius);
+	const FIntPoint MinCell = GetCell(Center - FVector(Radius));
+	const FIntPoint MaxCell = GetCell(Center + FVector(Radius));
+
+	const int32 FirstResult = OutInteractions.Num();
+	TArray<int32> Items;
+
+	/* Visit the Non Empty Cells Directly When the Query Covers More Cells Than Exist */
+	if (static_cast<int64>(MaxCell.X - MinCell.X + 1) * (MaxCell.Y - MinCell.Y + 1) >= Cells.Num())
+	{
+		for (const TPair<FIntPoint, FCell>& Cell : Cells)
+		{
+			QueryCell(Cell.Value, Center, RadiusSquared, RequiredMask, BlockedMask, ExactRequiredTags, ExactBlockedTags, OutInteractions, Items);
+		}
+	}
+	else
+	{
+		for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+		{
+			for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+			{
+				if (const FCell* Cell = Cells.Find(FIntPoint(X, Y)))
+				{
+					QueryCell(*Cell, Center, RadiusSquared, RequiredMask, BlockedMask, ExactRequiredTags, ExactBlockedTags, OutInteractions, Items);
+				}
+			}
+		}
+	}
+
+	if (OutItems != nullptr)
+	{
+		OutItems->Append(Items);
+		return;
+	}
+
+	/* Interactions Matching With Several Items are Returned Once */
+	TSet<const UInteractionComponent*> ItemInteractions;
+	int32 NumResults = FirstResult;
+
+	for (int32 Index = 0; Index < Items.Num(); ++Index)
+	{
+		UInteractionComponent* InteractionComponent = OutInteractions[FirstResult + Index];
+
+		bool bAlreadyAdded = false;
+		if (Items[Index] != INDEX_NONE)
+		{
+			ItemInteractions.Add(InteractionComponent, &bAlreadyAdded);
+		}
+
+		if (!bAlreadyAdded)
+		{
+			OutInteractions[NumResults++] = InteractionComponent;
+		}
+	}
+
+	OutInteractions.SetNum(NumResults, false);
+}
+
+void FInteractionTagIndex::QueryCell(const FCell& Cell, const FVector& Center, float RadiusSquared, const FInteractionTagMask& RequiredMask, const FInteractionTagMask& BlockedMask,
+	const FGameplayTagContainer* ExactRequiredTags, const FGameplayTagContainer* ExactBlockedTags, TArray<UInteractionComponent*>& OutInteractions, TArray<int32>& OutItems) const
+{
+	const VectorRegisterInt RequiredBits = VectorIntLoad(RequiredMask.Words);
+	const VectorRegisterInt BlockedBits = VectorIntLoad(BlockedMask.Words);
+
+	/* Skip the Cell If No Interaction in it Has Every Required Tag */
+	if (VectorMaskBits(VectorCastIntToFloat(VectorIntCompareEQ(VectorIntAndNot(VectorIntLoad(Cell.Union.Words), RequiredBits), GlobalVectorConstants::IntZero))) != 0xF)
+	{
+		return;
+	}
+
+	const int32 NumEntries = Cell.Masks.Num();
+
+	for (int32 Index = 0; Index < NumEntries; ++Index)
+	{
+		const VectorRegisterInt Bits = VectorIntLoad(Cell.Masks[Index].Words);
+
+		/* Missing Required Bits or Present Blocked Bits */
+		const VectorRegisterInt Rejected = VectorIntOr(VectorIntAndNot(Bits, RequiredBits), VectorIntAnd(Bits, BlockedBits));
+
+		if (VectorMaskBits(VectorCastIntToFloat(VectorIntCompareEQ(Rejected, GlobalVectorConstants::IntZero))) != 0xF)
+		{
+			continue;
+		}
+
+		if (FVector::DistSquared(Cell.Locations[Index], Center) > RadiusSquared)
+		{
+			continue;
+		}
+
+		/* Entries are Removed When their Interaction Unregisters, Guard Against Interactions Pending Kill Meanwhile */
+		UInteractionComponent* InteractionComponent = Cell.Components[Index];
+
+		if (!IsValid(InteractionComponent) || !InteractionComponent->IsActive())
+		{
+			continue;
+		}
+
+		if ((ExactRequiredTags != nullptr && !InteractionComponent->InteractionTags.HasAll(*ExactRequiredTags)) ||
+			(ExactBlockedTags != nullptr && InteractionComponent->InteractionTags.HasAny(*ExactBlockedTags)))
+		{
+			continue;
+		}
+
+		OutInteractions.Add(InteractionComponent);
+		OutItems.Add(Cell.Items[Index]);
+	}
+}
+
+void FInteractionTagIndex::Reset()
+{
+	TagBits.Empty();
+	Cells.Empty();
+	Slots.Empty();
+	NumInteractions = 0;
+	bTagBitsExhausted = false;
+}
+
+FInteractionTagMask FInteractionTagIndex::CompileInteractionTags(const FGameplayTagContainer& Tags)
+{
+	FInteractionTagMask Mask;
+
+	for (const FGameplayTag& Tag : Tags.GetGameplayTagParents())
+	{
+		int32 Bit = INDEX_NONE;
+
+		if (const int32* ExistingBit = TagBits.Find(Tag))
+		{
+			Bit = *ExistingBit;
+		}
+		else if (TagBits.Num() < FInteractionTagMask::MaxBits)
+		{
+			Bit = TagBits.Add(Tag, TagBits.Num());
+		}
+		else if (!bTagBitsExhausted)
+		{
+			UE_LOG(LogInteraction, Warning, TEXT("More Than %d Interaction Tags In Use, Queries on Further Tags Compare Tag Containers"), FInteractionTagMask::MaxBits);
+			bTagBitsExhausted = true;
+		}
+
+		if (Bit != INDEX_NONE)
+		{
+			Mask.SetBit(Bit);
+		}
+	}
+
+	return Mask;
+}
+
+bool FInteractionTagIndex::CompileQueryTags(const FGameplayTagContainer& Tags, FInteractionTagMask& OutMask, bool& bOutExact) const
+{
+	bool bCompiled = true;
+
+	for (const FGameplayTag& Tag : Tags)
+	{
+		if (const int32* Bit = TagBits.Find(Tag))
+		{
+			OutMask.SetBit(*Bit);
+		}
+		else
+		{
+			bCompiled = false;
+			bOutExact |= bTagBitsExhausted;
+		}
+	}
+
+	return bCompiled;
+}
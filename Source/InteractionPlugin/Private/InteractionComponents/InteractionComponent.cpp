@@ -3,6 +3,17 @@
 #include "InteractionComponent.h"
 #include "InteractorComponents/InteractorComponent.h"
 #include "Interface/InteractionInterface.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/BoxComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SphereComponent.h"
+#include "Subsystems/InteractionSubsystem.h"
+#include "Subsystems/InteractionSoakSubsystem.h"
+#include "Replication/InteractionNotificationBatch.h"
+#include "InteractionStats.h"
+#include "UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 
 DEFINE_LOG_CATEGORY(LogInteraction);
 
@@ -11,8 +22,371 @@ UInteractionComponent::UInteractionComponent()
 	,bMultipleInteraction(true)
 	,InteractionStateNetMode(EInteractionNetMode::INM_OwnerOnly)
 	,bOnlyFaceInteraction(false)
+	,Definition(nullptr)
+	,bOverride_InteractionStateNetMode(false)
+	,bOverride_bMultipleInteraction(false)
+	,bOverride_bOnlyFaceInteraction(false)
+	,bUseAnchor(false)
+	,AnchorComponentName(NAME_None)
+	,AnchorSocketName(NAME_None)
+	,AnchorOffset(FVector::ZeroVector)
+	,ProxyShape(EInteractionProxyShape::IPS_None)
+	,ProxyExtent(32.0f, 32.0f, 32.0f)
+	,ProxyComponent(nullptr)
+	,bPooled(false)
+	,bPooledCollisionEnabled(true)
+	,bPooledHidden(false)
+	,PendingGroupResult(EInteractionResult::IR_None)
+	,bGroupResultPending(false)
 {
 	this->SetIsReplicated(true);
+
+	/* Active State is Used to Pool and Persist Interactions */
+	bAutoActivate = true;
+}
+
+void UInteractionComponent::GetLifetimeReplicatedProps(TArray< FLifetimeProperty > & OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	/* Push Based, Only Compared When Changed by SetGroupMemberActors or SetInteractionTags */
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(UInteractionComponent, GroupMemberActors, Params);
+	DOREPLIFETIME_WITH_PARAMS_FAST(UInteractionComponent, InteractionTags, Params);
+}
+
+void UInteractionComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	UWorld* World = GetWorld();
+	UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+
+	if (IsValid(InteractionSubsystem))
+	{
+		InteractionSubsystem->RegisterInteraction(this);
+	}
+
+	/* Static and Stationary Anchors Never Move */
+	USceneComponent* Anchor = AnchorComponent.Get();
+	if (bUseAnchor && Anchor != nullptr && Anchor->Mobility == EComponentMobility::Movable)
+	{
+		AnchorTransformHandle = Anchor->TransformUpdated.AddUObject(this, &UInteractionComponent::OnAnchorTransformUpdated);
+	}
+}
+
+FName UInteractionComponent::GetPersistentId() const
+{
+	const AActor* Owner = GetOwner();
+
+	/* Only Level Placed Actors Have a Name Stable Across Streaming */
+	if (!IsValid(Owner) || !Owner->IsNetStartupActor())
+	{
+		return NAME_None;
+	}
+
+	return FName(*GetPathName());
+}
+
+void UInteractionComponent::WriteInteractionRecord(FInteractionRecord& OutRecord) const
+{
+	OutRecord.Location = GetInteractionLocation();
+	OutRecord.Definition = Definition;
+	OutRecord.bActive = IsActive();
+	OutRecord.State.Reset();
+}
+
+void UInteractionComponent::ReadInteractionRecord(const FInteractionRecord& Record)
+{
+	SetActive(Record.bActive);
+}
+
+void UInteractionComponent::Deactivate()
+{
+	if (IsActive())
+	{
+		InterruptAllInteractions();
+		ReleaseInteractionFocus();
+	}
+
+	Super::Deactivate();
+}
+
+void UInteractionComponent::ReleaseInteractionFocus()
+{
+	if (UInteractorComponent* FocusingInteractor = GetFocusingInteractor())
+	{
+		FocusingInteractor->LocalEndInteractionFocus(this);
+	}
+
+	SetInteractionFocusState(false);
+}
+
+UInteractorComponent* UInteractionComponent::GetFocusingInteractor() const
+{
+	const UWorld* World = GetWorld();
+	const UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+	const FInteractionSession* Focus = IsValid(InteractionSubsystem) ? InteractionSubsystem->FindFocus(InteractorFocus) : nullptr;
+
+	return Focus != nullptr ? Focus->Interactor.Get() : nullptr;
+}
+
+void UInteractionComponent::DeactivateInteraction()
+{
+	Deactivate();
+
+	UWorld* World = GetWorld();
+	UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+
+	/* Remove From Interaction Queries */
+	if (IsValid(InteractionSubsystem))
+	{
+		InteractionSubsystem->UnregisterInteraction(this);
+	}
+
+	AActor* Owner = GetOwner();
+	if (!IsValid(Owner))
+	{
+		return;
+	}
+
+	/* Keep the Owner State From Before the First Deactivation */
+	if (!bPooled)
+	{
+		bPooledCollisionEnabled = Owner->GetActorEnableCollision();
+		bPooledHidden = Owner->IsHidden();
+		bPooled = true;
+	}
+
+	/* Remove the Owner From Traces and Stop Replicating it While Pooled */
+	Owner->SetActorHiddenInGame(true);
+	Owner->SetActorEnableCollision(false);
+
+	if (Owner->HasAuthority())
+	{
+		Owner->SetNetDormancy(DORM_DormantAll);
+	}
+}
+
+void UInteractionComponent::ReactivateInteraction(const FTransform& NewTransform)
+{
+	ResetInteractionState();
+
+	AActor* Owner = GetOwner();
+	if (IsValid(Owner))
+	{
+		Owner->SetActorTransform(NewTransform, false, nullptr, ETeleportType::TeleportPhysics);
+		Owner->SetActorHiddenInGame(bPooledHidden);
+		Owner->SetActorEnableCollision(bPooledCollisionEnabled);
+
+		if (Owner->HasAuthority())
+		{
+			Owner->SetNetDormancy(DORM_Awake);
+			Owner->ForceNetUpdate();
+		}
+	}
+
+	bPooled = false;
+
+	Activate(true);
+
+	UWorld* World = GetWorld();
+	UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+
+	if (IsValid(InteractionSubsystem))
+	{
+		InteractionSubsystem->RegisterInteraction(this);
+	}
+}
+
+void UInteractionComponent::OnRegister()
+{
+	Super::OnRegister();
+
+	const UWorld* World = GetWorld();
+	const bool bGameWorld = IsValid(World) && World->IsGameWorld();
+
+	if (bUseAnchor)
+	{
+		ResolveAnchor(bGameWorld);
+	}
+
+	/* Proxies Only Exist Where Interactors Trace */
+	if (bGameWorld)
+	{
+		CreateProxyComponent();
+	}
+}
+
+void UInteractionComponent::OnUnregister()
+{
+	if (IsValid(ProxyComponent))
+	{
+		ProxyComponent->DestroyComponent();
+	}
+
+	ProxyComponent = nullptr;
+
+	Super::OnUnregister();
+}
+
+void UInteractionComponent::CreateProxyComponent()
+{
+	AActor* Owner = GetOwner();
+	if (ProxyShape == EInteractionProxyShape::IPS_None || !IsValid(Owner) || IsValid(ProxyComponent))
+	{
+		return;
+	}
+
+	/* Proxies on the Visibility Channel Would Block Every Visibility Trace, Only Use them When Opted In */
+	if (!UInteractionSubsystem::CanProxiesBlockTraceChannel())
+	{
+		UE_LOG(LogInteraction, Warning, TEXT("Interaction %s Skips its Proxy Shape, Select a Dedicated Interaction Trace Channel or Enable bProxiesBlockVisibility"), *GetName());
+		return;
+	}
+
+	/* Reuse the Existing Collision of the Anchor or Root Instead of Generating a Component */
+	if (ProxyShape == EInteractionProxyShape::IPS_Owner)
+	{
+		UPrimitiveComponent* OwnerPrimitive = Cast<UPrimitiveComponent>(AnchorComponent.IsValid() ? AnchorComponent.Get() : Owner->GetRootComponent());
+
+		if (IsValid(OwnerPrimitive))
+		{
+			OwnerPrimitive->SetCollisionResponseToChannel(UInteractionSubsystem::GetInteractionTraceChannel(), ECollisionResponse::ECR_Block);
+		}
+		else
+		{
+			UE_LOG(LogInteraction, Warning, TEXT("Interaction %s Uses the Owner Primitive Proxy but %s Has No Root or Anchor Primitive"), *GetName(), *Owner->GetName());
+		}
+
+		return;
+	}
+
+	switch (ProxyShape)
+	{
+		case EInteractionProxyShape::IPS_Sphere:
+		{
+			USphereComponent* SphereComponent = NewObject<USphereComponent>(Owner, NAME_None, RF_Transient);
+			SphereComponent->InitSphereRadius(ProxyExtent.X);
+			ProxyComponent = SphereComponent;
+			break;
+		}
+		case EInteractionProxyShape::IPS_Box:
+		{
+			UBoxComponent* BoxComponent = NewObject<UBoxComponent>(Owner, NAME_None, RF_Transient);
+			BoxComponent->InitBoxExtent(ProxyExtent);
+			ProxyComponent = BoxComponent;
+			break;
+		}
+		case EInteractionProxyShape::IPS_Capsule:
+		{
+			UCapsuleComponent* CapsuleComponent = NewObject<UCapsuleComponent>(Owner, NAME_None, RF_Transient);
+			CapsuleComponent->InitCapsuleSize(ProxyExtent.X, ProxyExtent.Z);
+			ProxyComponent = CapsuleComponent;
+			break;
+		}
+		default:
+			return;
+	}
+
+	/* Only Block the Interaction Trace Channel */
+	ProxyComponent->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	ProxyComponent->SetCollisionResponseToAllChannels(ECollisionResponse::ECR_Ignore);
+	ProxyComponent->SetCollisionResponseToChannel(UInteractionSubsystem::GetInteractionTraceChannel(), ECollisionResponse::ECR_Block);
+	ProxyComponent->SetGenerateOverlapEvents(false);
+	ProxyComponent->SetCanEverAffectNavigation(false);
+	ProxyComponent->CanCharacterStepUpOn = ECanBeCharacterBase::ECB_No;
+
+	/* Anchored Components are Detached, Follow the Anchor Instead */
+	USceneComponent* Anchor = AnchorComponent.Get();
+	if (bUseAnchor && Anchor != nullptr)
+	{
+		ProxyComponent->SetupAttachment(Anchor, AnchorSocketName);
+		ProxyComponent->SetRelativeLocation(AnchorOffset);
+	}
+	else
+	{
+		ProxyComponent->SetupAttachment(this);
+	}
+
+	ProxyComponent->RegisterComponent();
+}
+
+void UInteractionComponent::ResolveAnchor(bool bGameWorld)
+{
+	AActor* Owner = GetOwner();
+	USceneComponent* NewAnchor = IsValid(Owner) ? Owner->GetRootComponent() : nullptr;
+
+	/* Find the Named Anchor Component */
+	if (IsValid(Owner) && !AnchorComponentName.IsNone())
+	{
+		TInlineComponentArray<USceneComponent*> SceneComponents(Owner);
+
+		for (USceneComponent* SceneComponent : SceneComponents)
+		{
+			if (SceneComponent->GetFName() == AnchorComponentName)
+			{
+				NewAnchor = SceneComponent;
+				break;
+			}
+		}
+	}
+
+	AnchorComponent = NewAnchor != this ? NewAnchor : nullptr;
+
+	/* Detach at Runtime so Moving the Owner Does Not Propagate Transforms to this Component */
+	if (AnchorComponent.IsValid() && bGameWorld && GetAttachParent() != nullptr)
+	{
+		DetachFromComponent(FDetachmentTransformRules::KeepRelativeTransform);
+	}
+}
+
+FTransform UInteractionComponent::GetAnchorTransform() const
+{
+	const USceneComponent* Anchor = AnchorComponent.Get();
+
+	return Anchor != nullptr ? Anchor->GetSocketTransform(AnchorSocketName) : GetComponentTransform();
+}
+
+void UInteractionComponent::OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	Super::OnUpdateTransform(UpdateTransformFlags, Teleport);
+
+	UpdateInteractionIndexLocation();
+}
+
+void UInteractionComponent::OnAnchorTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport)
+{
+	UpdateInteractionIndexLocation();
+}
+
+void UInteractionComponent::UpdateInteractionIndexLocation()
+{
+	/* Untagged Interactions are Not Indexed, Skip the Subsystem on Every Move */
+	if (InteractionTags.IsEmpty() || !HasBegunPlay())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+
+	if (IsValid(InteractionSubsystem))
+	{
+		InteractionSubsystem->UpdateInteractionLocation(this);
+	}
+}
+
+FVector UInteractionComponent::GetInteractionLocation(int32 Item /* = -1 */) const
+{
+	return bUseAnchor ? GetAnchorTransform().TransformPosition(AnchorOffset) : GetComponentLocation();
+}
+
+FVector UInteractionComponent::GetInteractionForwardVector(int32 Item /* = -1 */) const
+{
+	return bUseAnchor ? GetAnchorTransform().GetUnitAxis(EAxis::X) : GetForwardVector();
 }
 
 void UInteractionComponent::SetInteractionFocusState(bool bNewFocus, UInteractorComponent* NewInteractorComponent /* = nullptr */)
@@ -23,7 +397,7 @@ void UInteractionComponent::SetInteractionFocusState(bool bNewFocus, UInteractor
 	}
 	
 	/* Set Focusing Interactor */
-	FocusingInteractor = NewInteractorComponent;
+	InteractorFocus = IsValid(NewInteractorComponent) ? NewInteractorComponent->GetCandidateFocus() : FInteractionHandle();
 }
 
 bool UInteractionComponent::StartInteraction(UInteractorComponent* InteractorComp)
@@ -52,6 +426,11 @@ bool UInteractionComponent::StopInteraction(UInteractorComponent* InteractorComp
 
 bool UInteractionComponent::CanInteractWith(UInteractorComponent* InteractorComp)
 {
+	/* Deactivated Interactions are Pooled or Disabled */
+	if (!IsActive())
+	{
+		return false;
+	}
 
 	/* Get Owner */
 	AActor* Owner = GetOwner();
@@ -66,6 +445,12 @@ bool UInteractionComponent::CanInteractWith(UInteractorComponent* InteractorComp
 	return true;
 }
 
+bool UInteractionComponent::TryQueueInteraction(UInteractorComponent* InteractorComp)
+{
+	/* Queueing is Only Supported by Duration Based Interactions */
+	return false;
+}
+
 void UInteractionComponent::CompleteInteraction(EInteractionResult InteractionResult, UInteractorComponent* InteractorComp)
 {
 	/* Validate Interactor Comp */
@@ -85,9 +470,198 @@ void UInteractionComponent::NotifyInteraction(EInteractionResult NewInteractionR
 	 * @note: OwnerOnly Notifications are Handled and Recieved By the Interactor Component
 	 */
 
-	if (InteractionStateNetMode == EInteractionNetMode::INM_All)
+	const bool bGroup = GroupMemberActors.Num() > 0;
+
+	if (GetStateNetMode() != EInteractionNetMode::INM_All)
+	{
+		if (bGroup)
+		{
+			FanOutGroupInteraction(NewInteractionResult, NewInteractionComponent);
+		}
+		return;
+	}
+
+	/* Interactions Only Notify Terminal Results, Sent Reliably and Sequenced */
+	const uint8 Sequence = ObserverSequence.Next();
+
+	/* Coalesce Notifications per Connection Until the End of the Frame */
+	if (UInteractionSubsystem* Batcher = UInteractionSubsystem::GetNotificationBatcher(this))
+	{
+		if (AcceptObserverNotification(Sequence, NewInteractionComponent))
+		{
+			ReceiveNotification(NewInteractionResult, NewInteractionComponent, bGroup);
+		}
+
+		Batcher->QueueMulticastNotification(this, NewInteractionComponent, NewInteractionResult, GetInteractionType(), bGroup ? INF_Group : 0, Sequence);
+		return;
+	}
+
+	/* Groups Replicate a Single Event For All Members */
+	if (bGroup)
+	{
+		Multi_NotifyGroupInteraction(NewInteractionResult, NewInteractionComponent, Sequence);
+	}
+	else
 	{
-		Multi_NotifyInteraction(NewInteractionResult, NewInteractionComponent);
+		Multi_NotifyInteraction(NewInteractionResult, NewInteractionComponent, Sequence);
+	}
+}
+
+void UInteractionComponent::ReceiveNotification(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent, bool bGroup)
+{
+	ClientNotifyInteraction(NewInteractionResult, NewInteractionComponent);
+
+	if (bGroup)
+	{
+		FanOutGroupInteraction(NewInteractionResult, NewInteractionComponent);
+	}
+}
+
+void UInteractionComponent::ReceiveOwnerNotification(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent)
+{
+	switch (GetStateNetMode())
+	{
+	case EInteractionNetMode::INM_OwnerOnly:
+		/* The Authority Already Fanned Out the Group in NotifyInteraction */
+		ReceiveNotification(NewInteractionResult, NewInteractionComponent, GroupMemberActors.Num() > 0 && GetOwnerRole() != ROLE_Authority);
+		break;
+	case EInteractionNetMode::INM_All:
+		ReceiveNotification(NewInteractionResult, NewInteractionComponent, GroupMemberActors.Num() > 0);
+		break;
+	default:
+		break;
+	}
+}
+
+bool UInteractionComponent::AcceptObserverNotification(uint8 Sequence, const UInteractorComponent* NewInteractionComponent)
+{
+	/* The Interactor Owner Receives the State Through the Reliable Interactor Notification */
+	if (IsValid(NewInteractionComponent) && NewInteractionComponent->ReceivesOwnerInteractionState())
+	{
+		return false;
+	}
+
+	if (GetOwnerRole() != ROLE_Authority && !ObserverSequence.Accept(Sequence))
+	{
+		INC_DWORD_STAT(STAT_InteractionStaleNotifications);
+		return false;
+	}
+
+	return true;
+}
+
+void UInteractionComponent::SetInteractionTags(const FGameplayTagContainer& NewInteractionTags)
+{
+	InteractionTags = NewInteractionTags;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(UInteractionComponent, InteractionTags, this);
+	UInteractionSoakSubsystem::CountPropertyBytes(this, GET_MEMBER_NAME_CHECKED(UInteractionComponent, InteractionTags));
+
+	UpdateInteractionIndex();
+}
+
+void UInteractionComponent::OnRep_InteractionTags()
+{
+	UpdateInteractionIndex();
+}
+
+void UInteractionComponent::UpdateInteractionIndex()
+{
+	/* Registration Indexes the Tags of Interactions Entering Play */
+	if (!HasBegunPlay())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+
+	if (IsValid(InteractionSubsystem))
+	{
+		InteractionSubsystem->UpdateInteractionTags(this);
+	}
+}
+
+void UInteractionComponent::SetGroupMemberActors(const TArray<AActor*>& NewGroupMemberActors)
+{
+	GroupMemberActors = NewGroupMemberActors;
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(UInteractionComponent, GroupMemberActors, this);
+	UInteractionSoakSubsystem::CountPropertyBytes(this, GET_MEMBER_NAME_CHECKED(UInteractionComponent, GroupMemberActors));
+}
+
+void UInteractionComponent::Multi_NotifyGroupInteraction_Implementation(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent, uint8 Sequence)
+{
+	if (AcceptObserverNotification(Sequence, NewInteractionComponent))
+	{
+		ReceiveNotification(NewInteractionResult, NewInteractionComponent, true);
+	}
+}
+
+void UInteractionComponent::FanOutGroupInteraction(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent)
+{
+	/* A New Result Supersedes the One Pending for Unresolved Members */
+	DeliveredGroupMembers.Reset();
+	bGroupResultPending = false;
+
+	const bool bDelivered = DeliverGroupInteraction(NewInteractionResult, NewInteractionComponent);
+
+	/* Members Not Relevant to this Client Yet Resolve to Null, Deliver to Them Once Mapped */
+	if (!bDelivered && GetOwnerRole() != ROLE_Authority)
+	{
+		PendingGroupResult = NewInteractionResult;
+		PendingGroupInteractor = NewInteractionComponent;
+		bGroupResultPending = true;
+	}
+	else
+	{
+		DeliveredGroupMembers.Reset();
+	}
+}
+
+bool UInteractionComponent::DeliverGroupInteraction(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent)
+{
+	bool bDeliveredAll = true;
+
+	for (AActor* GroupMemberActor : GroupMemberActors)
+	{
+		if (!IsValid(GroupMemberActor))
+		{
+			bDeliveredAll = false;
+			continue;
+		}
+
+		if (DeliveredGroupMembers.Contains(GroupMemberActor))
+		{
+			continue;
+		}
+
+		DeliveredGroupMembers.Add(GroupMemberActor);
+
+		UInteractionComponent* GroupMember = GroupMemberActor->FindComponentByClass<UInteractionComponent>();
+
+		/* Members Only Broadcast Locally, they Never Notify their Own Groups */
+		if (IsValid(GroupMember) && GroupMember != this)
+		{
+			GroupMember->ClientNotifyInteraction(NewInteractionResult, NewInteractionComponent);
+		}
+	}
+
+	return bDeliveredAll;
+}
+
+void UInteractionComponent::OnRep_GroupMemberActors()
+{
+	if (!bGroupResultPending)
+	{
+		return;
+	}
+
+	if (DeliverGroupInteraction(PendingGroupResult, PendingGroupInteractor.Get()))
+	{
+		DeliveredGroupMembers.Reset();
+		PendingGroupInteractor.Reset();
+		bGroupResultPending = false;
 	}
 }
 
@@ -101,13 +675,11 @@ void UInteractionComponent::ClientNotifyInteraction(EInteractionResult NewIntera
 	}
 }
 
-void UInteractionComponent::Multi_NotifyInteraction_Implementation(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent)
+void UInteractionComponent::Multi_NotifyInteraction_Implementation(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent, uint8 Sequence)
 {
-	if (OnInteractionStateChanged.IsBound())
+	if (AcceptObserverNotification(Sequence, NewInteractionComponent))
 	{
-		OnInteractionStateChanged.Broadcast(
-			NewInteractionResult,
-			IsValid(NewInteractionComponent) ? NewInteractionComponent->GetOwner() : nullptr);
+		ReceiveNotification(NewInteractionResult, NewInteractionComponent, false);
 	}
 }
 
@@ -116,7 +688,22 @@ void UInteractionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
-	if (IsValid(FocusingInteractor))
+	if (USceneComponent* Anchor = AnchorComponent.Get())
+	{
+		Anchor->TransformUpdated.Remove(AnchorTransformHandle);
+	}
+
+	AnchorTransformHandle.Reset();
+
+	UWorld* World = GetWorld();
+	UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+
+	if (IsValid(InteractionSubsystem))
+	{
+		InteractionSubsystem->UnregisterInteraction(this, EndPlayReason == EEndPlayReason::RemovedFromWorld);
+	}
+
+	if (UInteractorComponent* FocusingInteractor = GetFocusingInteractor())
 	{
 		FocusingInteractor->LocalEndInteractionFocus(this);
 	}
@@ -3,9 +3,16 @@
 #include "InteractionComponent_Hold.h"
 #include "Engine/World.h"
 #include "InteractorComponents/InteractorComponent.h"
+#include "Subsystems/InteractionRecorderSubsystem.h"
+#include "Subsystems/InteractionSubsystem.h"
 
 UInteractionComponent_Hold::UInteractionComponent_Hold()
 	:InteractionDuration(10.0f)
+	,bQueueInteractors(false)
+	,MaxQueuedInteractors(4)
+	,QueueOrder(EInteractionQueueOrder::IQO_FIFO)
+	,bOverride_InteractionDuration(false)
+	,bOverride_Queue(false)
 {
 	PrimaryComponentTick.bCanEverTick = false;
 	InteractionType = EInteractionType::IT_Hold;
@@ -27,6 +34,11 @@ bool UInteractionComponent_Hold::StartInteraction(UInteractorComponent* Interact
 
 void UInteractionComponent_Hold::OnHoldCompleted(UInteractorComponent* InteractorComp)
 {
+	if (UInteractionRecorderSubsystem* Recorder = UInteractionRecorderSubsystem::GetActiveRecorder(this))
+	{
+		Recorder->RecordHoldCompleted(InteractorComp, this);
+	}
+
 	if (IsInteractionTimeOver(InteractorComp))
 	{
 		/* Complete the Interaction */
@@ -38,8 +50,11 @@ void UInteractionComponent_Hold::OnHoldCompleted(UInteractorComponent* Interacto
 		CompleteInteraction(EInteractionResult::IR_Failed, InteractorComp);
 	}
 
-	/* Remove the Interactor from List */
-	Interactors.Remove(InteractorComp);
+	/* Remove the Session Ended by the Interactor */
+	PruneInteractionSessions();
+
+	/* Hand Over to the Next Queued Interactor */
+	PromoteQueuedInteractor();
 }
 
 bool UInteractionComponent_Hold::StopInteraction(UInteractorComponent* InteractorComp)
@@ -51,32 +66,156 @@ bool UInteractionComponent_Hold::StopInteraction(UInteractorComponent* Interacto
 	}
 
 	/* Notify Interactor of Interaction Interruption */
-	if (Interactors.Contains(InteractorComp))
+	if (HasInteractor(InteractorComp))
 	{
 		CompleteInteraction(EInteractionResult::IR_Interrupted, InteractorComp);
-	}
 
-	/* Remove the Interactor from List */
-	Interactors.Remove(InteractorComp);
+		/* Remove the Session Ended by the Interactor */
+		PruneInteractionSessions();
+
+		/* Hand Over to the Next Queued Interactor */
+		PromoteQueuedInteractor();
+	}
+	else if (RemoveQueuedInteractor(InteractorComp))
+	{
+		/* Notify Interactor of Leaving the Queue */
+		CompleteInteraction(EInteractionResult::IR_Interrupted, InteractorComp);
+	}
 
 	return true;
 }
 
 bool UInteractionComponent_Hold::CanInteractWith(UInteractorComponent* InteractoComp)
 {
-	return Super::CanInteractWith(InteractoComp) && bMultipleInteraction || Interactors.Num() == 0;
+	return Super::CanInteractWith(InteractoComp) && !IsOccupied();
+}
+
+bool UInteractionComponent_Hold::TryQueueInteraction(UInteractorComponent* InteractorComp)
+{
+	if (!ShouldQueueInteractors() || !IsValid(InteractorComp))
+	{
+		return false;
+	}
+
+	/* Only Queue Interactors Rejected Due to Occupation, Custom Conditions Still Apply */
+	if (!IsOccupied() || HasInteractor(InteractorComp) || !Super::CanInteractWith(InteractorComp))
+	{
+		return false;
+	}
+
+	/* Prevent Duplicate Entries */
+	const bool bAlreadyQueued = QueuedInteractors.ContainsByPredicate([InteractorComp](const FInteractionQueueEntry& Entry)
+	{
+		return Entry.Interactor == InteractorComp;
+	});
+
+	if (bAlreadyQueued || QueuedInteractors.Num() >= GetMaxQueuedInteractors())
+	{
+		return false;
+	}
+
+	const int32 Priority = GetQueueOrder() == EInteractionQueueOrder::IQO_Priority ? InteractorComp->InteractionQueuePriority : 0;
+
+	/* Insert After All Entries of Equal or Higher Priority to Keep FIFO Order Among Equals */
+	int32 InsertIndex = QueuedInteractors.Num();
+	for (int32 Index = 0; Index < QueuedInteractors.Num(); ++Index)
+	{
+		if (QueuedInteractors[Index].Priority < Priority)
+		{
+			InsertIndex = Index;
+			break;
+		}
+	}
+
+	QueuedInteractors.Insert(FInteractionQueueEntry(InteractorComp, Priority), InsertIndex);
+
+	UE_LOG(LogInteraction, Verbose, TEXT("Queued Interactor at Position %d of %d"), InsertIndex + 1, QueuedInteractors.Num());
+
+	return true;
+}
+
+int32 UInteractionComponent_Hold::GetMaxQueuedInteractors() const
+{
+	return Definition != nullptr && !bOverride_Queue ? Definition->MaxQueuedInteractors : MaxQueuedInteractors;
+}
+
+EInteractionQueueOrder UInteractionComponent_Hold::GetQueueOrder() const
+{
+	return Definition != nullptr && !bOverride_Queue ? Definition->QueueOrder : QueueOrder;
+}
+
+void UInteractionComponent_Hold::SetQueueInteractors(const bool bNewQueueInteractors)
+{
+	OverrideQueue();
+	bQueueInteractors = bNewQueueInteractors;
+}
+
+void UInteractionComponent_Hold::SetMaxQueuedInteractors(const int32 NewMaxQueuedInteractors)
+{
+	OverrideQueue();
+	MaxQueuedInteractors = FMath::Max(NewMaxQueuedInteractors, 1);
+}
+
+void UInteractionComponent_Hold::SetQueueOrder(const EInteractionQueueOrder NewQueueOrder)
+{
+	OverrideQueue();
+	QueueOrder = NewQueueOrder;
+}
+
+void UInteractionComponent_Hold::OverrideQueue()
+{
+	if (bOverride_Queue)
+	{
+		return;
+	}
+
+	/* The Override Covers All Queue Settings, Keep the Ones Not Being Set */
+	if (Definition != nullptr)
+	{
+		bQueueInteractors = Definition->bQueueInteractors;
+		MaxQueuedInteractors = Definition->MaxQueuedInteractors;
+		QueueOrder = Definition->QueueOrder;
+	}
+
+	bOverride_Queue = true;
+}
+
+bool UInteractionComponent_Hold::RemoveQueuedInteractor(UInteractorComponent* InteractorComponent)
+{
+	return QueuedInteractors.RemoveAll([InteractorComponent](const FInteractionQueueEntry& Entry)
+	{
+		return Entry.Interactor == InteractorComponent;
+	}) > 0;
+}
+
+void UInteractionComponent_Hold::PromoteQueuedInteractor()
+{
+	while (QueuedInteractors.Num() > 0 && !IsOccupied())
+	{
+		UInteractorComponent* NextInteractor = QueuedInteractors[0].Interactor.Get();
+		QueuedInteractors.RemoveAt(0);
+
+		/* Skip Interactors that Were Destroyed or Can No Longer Interact */
+		if (IsValid(NextInteractor))
+		{
+			NextInteractor->StartQueuedInteraction(this);
+		}
+	}
 }
 
 bool UInteractionComponent_Hold::IsInteractionTimeOver(const UInteractorComponent* InteractorComponent) const
 {
-	if (Interactors.Contains(InteractorComponent))
+	const FInteractionSessionTable* SessionTable = GetSessionTable();
+	const FInteractionSession* Session = SessionTable != nullptr && HasInteractor(InteractorComponent) ? SessionTable->FindAlive(InteractorComponent->GetInteractionSession()) : nullptr;
+
+	if (Session != nullptr)
 	{
 		const UWorld* World = GetWorld();
 
 		/* Interaction Duration With Addition Error Tolerance of 0.5 */
-		const float ErrorToleranceDuration = InteractionDuration - 0.5f;
+		const float ErrorToleranceDuration = GetInteractionDuration() - 0.5f;
 
-		return IsValid(World) ? Interactors[InteractorComponent] + ErrorToleranceDuration <= World->GetTimeSeconds() : false;
+		return IsValid(World) ? Session->StartTime + ErrorToleranceDuration <= World->GetTimeSeconds() : false;
 
 	}
 
@@ -85,10 +224,95 @@ bool UInteractionComponent_Hold::IsInteractionTimeOver(const UInteractorComponen
 
 void UInteractionComponent_Hold::AddInteractor(UInteractorComponent* InteractorComponent)
 {
-	/* Get World and Time Seconds */
+	/* The Interactor Begins the Session, Holding the Initiation Game Time */
+	const FInteractionHandle Session = IsValid(InteractorComponent) ? InteractorComponent->GetInteractionSession() : FInteractionHandle();
+
+	if (!Session.IsValid())
+	{
+		UE_LOG(LogInteraction, Warning, TEXT("Unable to Track Hold Interaction Due to Missing Interaction Session"));
+		return;
+	}
+
+	PruneInteractionSessions();
+
+	InteractionSessions.AddUnique(Session);
+}
+
+bool UInteractionComponent_Hold::HasInteractor(const UInteractorComponent* InteractorComponent) const
+{
+	return IsValid(InteractorComponent) && InteractorComponent->GetInteractionSession().IsValid() &&
+		InteractionSessions.Contains(InteractorComponent->GetInteractionSession());
+}
+
+bool UInteractionComponent_Hold::IsOccupied() const
+{
+	if (AllowsMultipleInteraction())
+	{
+		return false;
+	}
+
+	const FInteractionSessionTable* SessionTable = GetSessionTable();
+	if (SessionTable == nullptr)
+	{
+		return false;
+	}
+
+	/* A Single Live Session Occupies the Interaction */
+	for (const FInteractionHandle& Handle : InteractionSessions)
+	{
+		if (SessionTable->FindAlive(Handle) != nullptr)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+int32 UInteractionComponent_Hold::GetNumActiveSessions() const
+{
+	const FInteractionSessionTable* SessionTable = GetSessionTable();
+	if (SessionTable == nullptr)
+	{
+		return 0;
+	}
+
+	/* Generation Checks Detect Ended Sessions Without Touching the Interactors */
+	int32 NumActiveSessions = 0;
+
+	for (const FInteractionHandle& Handle : InteractionSessions)
+	{
+		if (SessionTable->FindAlive(Handle) != nullptr)
+		{
+			++NumActiveSessions;
+		}
+	}
+
+	return NumActiveSessions;
+}
+
+void UInteractionComponent_Hold::PruneInteractionSessions()
+{
+	const FInteractionSessionTable* SessionTable = GetSessionTable();
+
+	InteractionSessions.RemoveAll([SessionTable](FInteractionHandle Handle)
+	{
+		return SessionTable == nullptr || SessionTable->FindAlive(Handle) == nullptr;
+	});
+}
+
+const FInteractionSessionTable* UInteractionComponent_Hold::GetSessionTable() const
+{
+	const UInteractionSubsystem* InteractionSubsystem = GetInteractionSubsystem();
+
+	return IsValid(InteractionSubsystem) ? &InteractionSubsystem->GetSessions() : nullptr;
+}
+
+UInteractionSubsystem* UInteractionComponent_Hold::GetInteractionSubsystem() const
+{
 	const UWorld* World = GetWorld();
-	
-	Interactors.Add(InteractorComponent, IsValid(World) ? World->GetTimeSeconds() : 0.0f);
+
+	return IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
 }
 
 void UInteractionComponent_Hold::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -98,11 +322,47 @@ void UInteractionComponent_Hold::EndPlay(const EEndPlayReason::Type EndPlayReaso
 	if (EndPlayReason == EEndPlayReason::Destroyed ||
 		EndPlayReason == EEndPlayReason::RemovedFromWorld)
 	{
-		for (auto EachInteractor : Interactors)
+		InterruptAllInteractions();
+	}
+}
+
+void UInteractionComponent_Hold::ResetInteractionState()
+{
+	Super::ResetInteractionState();
+
+	InteractionSessions.Empty();
+	QueuedInteractors.Reset();
+}
+
+void UInteractionComponent_Hold::InterruptAllInteractions()
+{
+	/* Resolve the Interactors First as Completing an Interaction Ends its Session */
+	TArray<UInteractorComponent*> ActiveInteractors;
+
+	if (const FInteractionSessionTable* SessionTable = GetSessionTable())
+	{
+		for (const FInteractionHandle& Handle : InteractionSessions)
 		{
-			CompleteInteraction(EInteractionResult::IR_Interrupted, EachInteractor.Key);
+			if (const FInteractionSession* Session = SessionTable->FindAlive(Handle))
+			{
+				ActiveInteractors.Add(Session->Interactor.Get());
+			}
 		}
+	}
+
+	InteractionSessions.Empty();
+
+	for (UInteractorComponent* EachInteractor : ActiveInteractors)
+	{
+		CompleteInteraction(EInteractionResult::IR_Interrupted, EachInteractor);
+	}
 
-		Interactors.Empty();
+	/* Release Interactors Waiting in the Queue */
+	TArray<FInteractionQueueEntry> PendingInteractors = MoveTemp(QueuedInteractors);
+	QueuedInteractors.Reset();
+
+	for (const FInteractionQueueEntry& Entry : PendingInteractors)
+	{
+		CompleteInteraction(EInteractionResult::IR_Interrupted, Entry.Interactor.Get());
 	}
 }
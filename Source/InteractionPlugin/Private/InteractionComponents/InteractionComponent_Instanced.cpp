@@ -0,0 +1,330 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "InteractionComponent_Instanced.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "GameFramework/Actor.h"
+#include "UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
+#include "InteractorComponents/InteractorComponent.h"
+#include "Subsystems/InteractionSubsystem.h"
+#include "Subsystems/InteractionSoakSubsystem.h"
+
+void FInteractionInstanceState::PreReplicatedRemove(const FInteractionInstanceStateArray& InArraySerializer)
+{
+	if (IsValid(InArraySerializer.OwnerComponent))
+	{
+		InArraySerializer.OwnerComponent->ApplyInstanceState(InstanceIndex, false);
+	}
+}
+
+void FInteractionInstanceState::PostReplicatedAdd(const FInteractionInstanceStateArray& InArraySerializer)
+{
+	if (IsValid(InArraySerializer.OwnerComponent))
+	{
+		InArraySerializer.OwnerComponent->ApplyInstanceState(InstanceIndex, bConsumed);
+	}
+}
+
+void FInteractionInstanceState::PostReplicatedChange(const FInteractionInstanceStateArray& InArraySerializer)
+{
+	if (IsValid(InArraySerializer.OwnerComponent))
+	{
+		InArraySerializer.OwnerComponent->ApplyInstanceState(InstanceIndex, bConsumed);
+	}
+}
+
+UInteractionComponent_Instanced::UInteractionComponent_Instanced()
+	:InstancedMeshName(NAME_None)
+	,bConsumeOnSuccess(true)
+	,ConsumedCustomDataIndex(0)
+	,InstancedMesh(nullptr)
+{
+	/* Each Instance is a Separate Interactable, Multiple Interaction Applies per Instance */
+	bMultipleInteraction = false;
+	InteractionDuration = 1.0f;
+
+	InstanceStates.OwnerComponent = this;
+}
+
+void UInteractionComponent_Instanced::GetLifetimeReplicatedProps(TArray< FLifetimeProperty > & OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(UInteractionComponent_Instanced, InstanceStates, Params);
+}
+
+void UInteractionComponent_Instanced::OnRegister()
+{
+	Super::OnRegister();
+
+	InstanceStates.OwnerComponent = this;
+
+	/* Find the Instanced Static Mesh */
+	AActor* Owner = GetOwner();
+	if (!IsValid(Owner))
+	{
+		return;
+	}
+
+	TInlineComponentArray<UInstancedStaticMeshComponent*> InstancedComponents(Owner);
+
+	for (UInstancedStaticMeshComponent* InstancedComponent : InstancedComponents)
+	{
+		if (InstancedMeshName.IsNone() || InstancedComponent->GetFName() == InstancedMeshName)
+		{
+			InstancedMesh = InstancedComponent;
+			break;
+		}
+	}
+
+	if (!IsValid(InstancedMesh))
+	{
+		UE_LOG(LogInteraction, Warning, TEXT("Instanced Interaction on %s Has No Instanced Static Mesh Component"), *Owner->GetName());
+		return;
+	}
+
+	/* Consumed Instances are Hidden Through Custom Data, Make Room For the Consumed Float */
+	if (InstancedMesh->NumCustomDataFloats <= ConsumedCustomDataIndex)
+	{
+		UE_LOG(LogInteraction, Warning, TEXT("Instanced Interaction on %s Expects %d Custom Data Floats on %s, Resizing"), *Owner->GetName(), ConsumedCustomDataIndex + 1, *InstancedMesh->GetName());
+		InstancedMesh->SetNumCustomDataFloats(ConsumedCustomDataIndex + 1);
+	}
+}
+
+bool UInteractionComponent_Instanced::ResolveInteractionItem(const FHitResult& Hit, int32& OutItem) const
+{
+	OutItem = INDEX_NONE;
+
+	/* Other Components of the Actor, Including Other Instanced Meshes, are Not Part of this Interaction */
+	if (InstancedMesh == nullptr || Hit.GetComponent() != InstancedMesh || !IsInstanceAvailable(Hit.Item))
+	{
+		return false;
+	}
+
+	OutItem = Hit.Item;
+	return true;
+}
+
+int32 UInteractionComponent_Instanced::GetNumInteractionItems() const
+{
+	return IsValid(InstancedMesh) ? InstancedMesh->GetInstanceCount() : 0;
+}
+
+FVector UInteractionComponent_Instanced::GetInteractionLocation(int32 Item /* = -1 */) const
+{
+	FTransform InstanceTransform;
+	if (IsValid(InstancedMesh) && InstancedMesh->GetInstanceTransform(Item, InstanceTransform, true))
+	{
+		return InstanceTransform.GetLocation();
+	}
+
+	return Super::GetInteractionLocation(Item);
+}
+
+FVector UInteractionComponent_Instanced::GetInteractionForwardVector(int32 Item /* = -1 */) const
+{
+	FTransform InstanceTransform;
+	if (IsValid(InstancedMesh) && InstancedMesh->GetInstanceTransform(Item, InstanceTransform, true))
+	{
+		return InstanceTransform.GetUnitAxis(EAxis::X);
+	}
+
+	return Super::GetInteractionForwardVector(Item);
+}
+
+bool UInteractionComponent_Instanced::CanInteractWith(UInteractorComponent* InteractorComp)
+{
+	if (!IsValid(InteractorComp))
+	{
+		return false;
+	}
+
+	const int32 InstanceIndex = InteractorComp->GetInteractionItem();
+
+	/* Skip the Component Wide Occupation of Hold, Occupation Applies per Instance */
+	return IsInstanceAvailable(InstanceIndex) &&
+		!IsInstanceOccupied(InstanceIndex) &&
+		UInteractionComponent::CanInteractWith(InteractorComp);
+}
+
+bool UInteractionComponent_Instanced::StartInteraction(UInteractorComponent* InteractorComp)
+{
+	if (!Super::StartInteraction(InteractorComp))
+	{
+		return false;
+	}
+
+	/* Drop Instances Held by Interactors Destroyed Mid Interaction */
+	for (auto It = InteractorInstances.CreateIterator(); It; ++It)
+	{
+		if (!It->Key.IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	InteractorInstances.Add(InteractorComp, InteractorComp->GetInteractionItem());
+
+	return true;
+}
+
+void UInteractionComponent_Instanced::CompleteInteraction(EInteractionResult InteractionResult, UInteractorComponent* InteractorComp)
+{
+	int32 InstanceIndex = INDEX_NONE;
+
+	/* Release the Instance Before Notifying the Interactor */
+	if (InteractorInstances.RemoveAndCopyValue(InteractorComp, InstanceIndex) &&
+		InteractionResult == EInteractionResult::IR_Successful &&
+		bConsumeOnSuccess)
+	{
+		SetInstanceConsumed(InstanceIndex, true);
+	}
+
+	Super::CompleteInteraction(InteractionResult, InteractorComp);
+}
+
+void UInteractionComponent_Instanced::ResetInteractionState()
+{
+	Super::ResetInteractionState();
+
+	InteractorInstances.Empty();
+
+	for (const FInteractionInstanceState& State : InstanceStates.Items)
+	{
+		ApplyInstanceState(State.InstanceIndex, false);
+	}
+
+	InstanceStates.Items.Empty();
+	InstanceStates.MarkArrayDirty();
+	MARK_PROPERTY_DIRTY_FROM_NAME(UInteractionComponent_Instanced, InstanceStates, this);
+
+	ConsumedInstances.Reset();
+}
+
+void UInteractionComponent_Instanced::WriteInteractionRecord(FInteractionRecord& OutRecord) const
+{
+	Super::WriteInteractionRecord(OutRecord);
+
+	/* Pack One Bit per Instance */
+	OutRecord.State.SetNumZeroed((ConsumedInstances.Num() + 7) / 8);
+
+	for (TConstSetBitIterator<> It(ConsumedInstances); It; ++It)
+	{
+		OutRecord.State[It.GetIndex() / 8] |= 1 << (It.GetIndex() % 8);
+	}
+}
+
+void UInteractionComponent_Instanced::ReadInteractionRecord(const FInteractionRecord& Record)
+{
+	Super::ReadInteractionRecord(Record);
+
+	for (int32 ByteIndex = 0; ByteIndex < Record.State.Num(); ++ByteIndex)
+	{
+		for (int32 Bit = 0; Bit < 8; ++Bit)
+		{
+			if (Record.State[ByteIndex] & (1 << Bit))
+			{
+				SetInstanceConsumed(ByteIndex * 8 + Bit, true);
+			}
+		}
+	}
+}
+
+bool UInteractionComponent_Instanced::IsInstanceAvailable(int32 InstanceIndex) const
+{
+	return IsValid(InstancedMesh) &&
+		InstanceIndex >= 0 &&
+		InstanceIndex < InstancedMesh->GetInstanceCount() &&
+		!IsInstanceConsumed(InstanceIndex);
+}
+
+bool UInteractionComponent_Instanced::IsInstanceOccupied(int32 InstanceIndex) const
+{
+	if (AllowsMultipleInteraction())
+	{
+		return false;
+	}
+
+	for (const auto& EachInteractor : InteractorInstances)
+	{
+		if (EachInteractor.Value == InstanceIndex && EachInteractor.Key.IsValid())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool UInteractionComponent_Instanced::IsInstanceConsumed(int32 InstanceIndex) const
+{
+	return ConsumedInstances.IsValidIndex(InstanceIndex) && ConsumedInstances[InstanceIndex];
+}
+
+void UInteractionComponent_Instanced::SetInstanceConsumed(int32 InstanceIndex, bool bConsumed)
+{
+	if (InstanceIndex < 0 || IsInstanceConsumed(InstanceIndex) == bConsumed)
+	{
+		return;
+	}
+
+	/* Only Consumed Instances Have an Entry, the Default State is Replicated by Removing it */
+	if (bConsumed)
+	{
+		FInteractionInstanceState& State = InstanceStates.Items.AddDefaulted_GetRef();
+		State.InstanceIndex = InstanceIndex;
+		State.bConsumed = true;
+
+		InstanceStates.MarkItemDirty(State);
+		UInteractionSoakSubsystem::CountItemBytes(this, FInteractionInstanceState::StaticStruct(), &State);
+	}
+	else
+	{
+		const int32 StateIndex = InstanceStates.Items.IndexOfByPredicate([InstanceIndex](const FInteractionInstanceState& Entry)
+		{
+			return Entry.InstanceIndex == InstanceIndex;
+		});
+
+		if (StateIndex != INDEX_NONE)
+		{
+			InstanceStates.Items.RemoveAtSwap(StateIndex);
+			InstanceStates.MarkArrayDirty();
+		}
+	}
+
+	MARK_PROPERTY_DIRTY_FROM_NAME(UInteractionComponent_Instanced, InstanceStates, this);
+
+	ApplyInstanceState(InstanceIndex, bConsumed);
+}
+
+void UInteractionComponent_Instanced::ApplyInstanceState(int32 InstanceIndex, bool bConsumed)
+{
+	if (InstanceIndex < 0)
+	{
+		return;
+	}
+
+	if (ConsumedInstances.Num() <= InstanceIndex)
+	{
+		ConsumedInstances.Add(false, InstanceIndex + 1 - ConsumedInstances.Num());
+	}
+
+	ConsumedInstances[InstanceIndex] = bConsumed;
+
+	if (!IsValid(InstancedMesh) || InstanceIndex >= InstancedMesh->GetInstanceCount())
+	{
+		return;
+	}
+
+	/* Hide Through Custom Data Read by the Material, Instance Indices and the Instance Tree Stay Untouched */
+	InstancedMesh->SetCustomDataValue(InstanceIndex, ConsumedCustomDataIndex, bConsumed ? 1.0f : 0.0f, true);
+
+	/* Consumed Instances Stop Blocking, Restored Ones Use the Collision of the Mesh Again */
+	if (InstancedMesh->InstanceBodies.IsValidIndex(InstanceIndex) && InstancedMesh->InstanceBodies[InstanceIndex] != nullptr)
+	{
+		InstancedMesh->InstanceBodies[InstanceIndex]->SetCollisionEnabled(bConsumed ? ECollisionEnabled::NoCollision : InstancedMesh->BodyInstance.GetCollisionEnabled());
+	}
+}
@@ -2,10 +2,19 @@
 
 #include "InteractorComponent.h"
 #include "Runtime/Engine/Classes/GameFramework/Actor.h"
+#include "Engine/World.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerState.h"
 #include "UnrealNetwork.h"
+#include "Net/Core/PushModel/PushModel.h"
 #include "InteractionComponents/InteractionComponent.h"
 #include "InteractionComponents/InteractionComponent_Hold.h"
 #include "Interface/InteractionInterface.h"
+#include "Subsystems/InteractionSubsystem.h"
+#include "Subsystems/InteractionRecorderSubsystem.h"
+#include "Subsystems/InteractionSoakSubsystem.h"
+#include "InteractionStats.h"
 
 #if WITH_EDITORONLY_DATA
 #include "DrawDebugHelpers.h"
@@ -13,10 +22,28 @@
 
 DEFINE_LOG_CATEGORY(LogInteractor);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Interaction Traces"), STAT_InteractionTraces, STATGROUP_Interaction);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Interaction Traces Skipped"), STAT_InteractionTracesSkipped, STATGROUP_Interaction);
+
 UInteractorComponent::UInteractorComponent()
 	:bInteracting(false),
+	bInteractionQueued(false),
 	InteractorStateNetMode(EInteractionNetMode::INM_OwnerOnly),
-	InteractorReachLength(120.0f)
+	InteractorReachLength(120.0f),
+	InteractionQueuePriority(0),
+	InteractionItem(INDEX_NONE),
+	TraceItem(INDEX_NONE),
+	ServerRequestRate(8.0f),
+	ServerRequestBurst(4.0f),
+	bUseTraceCoherence(true),
+	TraceCoherenceMaxStaleness(0.25f),
+	TraceCoherenceDistanceThreshold(2.0f),
+	TraceCoherenceAngleThreshold(0.5f),
+	bTraceComplex(true),
+	bParallelServerUpdate(false),
+	LatencyRequestTime(0.0),
+	LatencyRequestSequence(0),
+	NotificationCount(0)
 {
 	PrimaryComponentTick.bCanEverTick = true;
 	this->SetIsReplicated(true);
@@ -26,7 +53,25 @@ void UInteractorComponent::GetLifetimeReplicatedProps(TArray< FLifetimeProperty
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME(UInteractorComponent, bInteracting);
+	/* Push Based, Only Compared When Marked Dirty by SetInteracting */
+	FDoRepLifetimeParams Params;
+	Params.bIsPushBased = true;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(UInteractorComponent, bInteracting, Params);
+
+	/* Hold Progress Only Replicates to Observers When the State is Meant for All */
+	FDoRepLifetimeParams HoldProgressParams;
+	HoldProgressParams.bIsPushBased = true;
+	HoldProgressParams.Condition = COND_Custom;
+
+	DOREPLIFETIME_WITH_PARAMS_FAST(UInteractorComponent, HoldProgress, HoldProgressParams);
+}
+
+void UInteractorComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(UInteractorComponent, HoldProgress, ReplicatesHoldProgress());
 }
 
 void UInteractorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
@@ -34,10 +79,28 @@ void UInteractorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	Super::EndPlay(EndPlayReason);
 
 	if ((EndPlayReason == EEndPlayReason::Destroyed ||
-		EndPlayReason == EEndPlayReason::RemovedFromWorld) && bInteracting)
+		EndPlayReason == EEndPlayReason::RemovedFromWorld) && (bInteracting || bInteractionQueued))
 	{
 		TryStopInteraction();
 	}
+
+	/* Release the Session Even If the Interaction Was Already Gone */
+	EndInteractionSession();
+
+	SetInteractionCandidate(nullptr);
+
+	if (bParallelServerUpdate)
+	{
+		UWorld* World = GetWorld();
+		UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+
+		if (IsValid(InteractionSubsystem))
+		{
+			InteractionSubsystem->UnregisterServerInteractor(this);
+		}
+
+		bParallelServerUpdate = false;
+	}
 }
 
 // Called when the game starts
@@ -49,10 +112,28 @@ void UInteractorComponent::BeginPlay()
 	SetComponentTickEnabled(
 		ShouldTickInstance()
 	);	
+
+	/* Let the Interaction Subsystem Validate Server Side Interactions in Parallel */
+	UWorld* World = GetWorld();
+	UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+
+	if (GetInteractorRole() == ROLE_Authority && IsValid(InteractionSubsystem) && InteractionSubsystem->bParallelServerUpdate)
+	{
+		InteractionSubsystem->RegisterServerInteractor(this);
+		bParallelServerUpdate = true;
+
+		/* Remote Interactors Have Nothing Left to Tick */
+		if (!IsLocalInteractor())
+		{
+			SetComponentTickEnabled(false);
+		}
+	}
 }
 
 UInteractionComponent* UInteractorComponent::GetInteractionTrace()
 {
+	TraceItem = INDEX_NONE;
+
 	/* Get World */
 	const UWorld* World = GetWorld();
 	if (World == nullptr)
@@ -69,7 +150,7 @@ UInteractionComponent* UInteractorComponent::GetInteractionTrace()
 
 	/* Set Query Params */
 	const FName TraceTag("InteractionTrace");
-	FCollisionQueryParams QueryParams = FCollisionQueryParams(TraceTag, true, Owner);
+	FCollisionQueryParams QueryParams = FCollisionQueryParams(TraceTag, bTraceComplex, Owner);
 
 	/* Get Start Location and Rotation */
 	FVector OutLocation;
@@ -84,47 +165,164 @@ UInteractionComponent* UInteractorComponent::GetInteractionTrace()
 	FHitResult OutHit;
 
 #if WITH_EDITORONLY_DATA
-	if (bDrawInteractorTrace)
+	if (bDrawInteractorTrace && IsInGameThread())
 	{
 		DrawDebugLine(World, StartLocation, EndLocation, FColor::Red, false, 0.0f, 1.f);
 	}
 #endif
 
 	/* Single Line Trace */
-	const bool bHit = World->LineTraceSingleByChannel(OutHit, StartLocation, EndLocation, ECollisionChannel::ECC_Visibility, QueryParams);
+	const bool bHit = World->LineTraceSingleByChannel(OutHit, StartLocation, EndLocation, UInteractionSubsystem::GetInteractionTraceChannel(), QueryParams);
+
+	INC_DWORD_STAT(STAT_InteractionTraces);
+
+	TraceCache.ViewLocation = StartLocation;
+	TraceCache.ViewRotation = OutRotator;
+	TraceCache.TraceTime = World->GetTimeSeconds();
+	TraceCache.InteractionComponent = nullptr;
+	TraceCache.bValid = false;
 
 	/* Get Interaction Component */
-	if (bHit)
+	if (bHit && OutHit.GetActor() != nullptr)
 	{
-		UActorComponent* ActorComp = OutHit.Actor->GetComponentByClass(UInteractionComponent::StaticClass());
+		UInteractionComponent* InteractionComp = nullptr;
+
+		/* Proxy Shapes Resolve to the Interaction that Generated Them */
+		TInlineComponentArray<UInteractionComponent*> InteractionComponents(OutHit.GetActor());
+		for (UInteractionComponent* Candidate : InteractionComponents)
+		{
+			if (Candidate->GetProxyComponent() != nullptr && Candidate->GetProxyComponent() == OutHit.GetComponent())
+			{
+				InteractionComp = Candidate;
+				break;
+			}
+		}
+
+		if (InteractionComp == nullptr)
+		{
+			UActorComponent* ActorComp = OutHit.GetActor()->GetComponentByClass(UInteractionComponent::StaticClass());
+
+			InteractionComp = Cast <UInteractionComponent>(ActorComp);
+		}
 
-		return Cast <UInteractionComponent>(ActorComp);
+		/* Resolve the Hit Item For Components Handling Multiple Interactables */
+		if (IsValid(InteractionComp))
+		{
+			/* Hits Not Belonging to Any Item of the Interaction are Rejected */
+			if (!InteractionComp->ResolveInteractionItem(OutHit, TraceItem))
+			{
+				TraceItem = INDEX_NONE;
+				return nullptr;
+			}
+
+			/* Only Single Item Hits are Cached, Component Bounds Don't Identify an Item */
+			if (TraceItem == INDEX_NONE && OutHit.GetComponent() != nullptr)
+			{
+				TraceCache.HitBounds = OutHit.GetComponent()->Bounds.GetBox();
+				TraceCache.HitDistance = OutHit.Distance;
+				TraceCache.InteractionComponent = InteractionComp;
+				TraceCache.bValid = true;
+			}
+		}
+
+		return InteractionComp;
 	}
 
 	return nullptr;
 
 }
 
-bool UInteractorComponent::ValidateDirection(const UInteractionComponent* InteractionComponent) const
+bool UInteractorComponent::TryGetInteraction(UInteractionComponent*& OutInteractionComponent, int32& OutItem)
 {
-	if (!IsValid(InteractionComponent))
+	OutInteractionComponent = GetInteractionTrace();
+	OutItem = IsValid(OutInteractionComponent) ? TraceItem : INDEX_NONE;
+
+	return ValidateDirection(OutInteractionComponent, OutItem);
+}
+
+bool UInteractorComponent::IsTraceCacheCoherent(const FVector& ViewLocation, const FRotator& ViewRotation, float CurrentTime) const
+{
+	if (!TraceCache.bValid || CurrentTime - TraceCache.TraceTime > TraceCoherenceMaxStaleness)
+	{
+		return false;
+	}
+
+	const UInteractionComponent* CachedInteraction = TraceCache.InteractionComponent.Get();
+	if (CachedInteraction == nullptr || !CachedInteraction->IsActive())
+	{
+		return false;
+	}
+
+	/* View Point Barely Moved */
+	const float MovedDistance = FVector::Dist(ViewLocation, TraceCache.ViewLocation);
+	if (MovedDistance > TraceCoherenceDistanceThreshold)
+	{
+		return false;
+	}
+
+	const FVector ViewDirection = ViewRotation.Vector();
+	const float CosAngleThreshold = FMath::Cos(FMath::DegreesToRadians(TraceCoherenceAngleThreshold));
+	if ((ViewDirection | TraceCache.ViewRotation.Vector()) < CosAngleThreshold)
+	{
+		return false;
+	}
+
+	/* Cached Hit Must Stay Within Reach */
+	if (TraceCache.HitDistance + MovedDistance > InteractorReachLength)
+	{
+		return false;
+	}
+
+	/* Ray Still Aims at the Cached Bounds */
+	const FVector EndLocation = ViewLocation + ViewDirection * InteractorReachLength;
+	return FMath::LineBoxIntersection(TraceCache.HitBounds, ViewLocation, EndLocation, EndLocation - ViewLocation);
+}
+
+UInteractionComponent* UInteractorComponent::GetCoherentInteractionTrace()
+{
+	const UWorld* World = GetWorld();
+	const AActor* Owner = GetOwner();
+
+	if (bUseTraceCoherence && World != nullptr && IsValid(Owner))
+	{
+		FVector ViewLocation;
+		FRotator ViewRotation;
+
+		Owner->GetActorEyesViewPoint(ViewLocation, ViewRotation);
+
+		if (IsTraceCacheCoherent(ViewLocation, ViewRotation, World->GetTimeSeconds()))
+		{
+			INC_DWORD_STAT(STAT_InteractionTracesSkipped);
+
+			TraceItem = INDEX_NONE;
+			return TraceCache.InteractionComponent.Get();
+		}
+	}
+
+	return GetInteractionTrace();
+}
+
+bool UInteractorComponent::ValidateDirection(const UInteractionComponent* InteractionComponent, int32 Item /* = -1 */) const
+{
+	/* Deactivated Interactions are Pooled and Can't be Focused */
+	if (!IsValid(InteractionComponent) || !InteractionComponent->IsActive())
 	{
 		return false;
 	}
 	
 	/* Return True Early If Face Only Interaction is Not Required */
-	if (!InteractionComponent->bOnlyFaceInteraction)
+	if (!InteractionComponent->RequiresFaceInteraction())
 	{
 		return true;
 	}
 
 	/* Get Interactor Direction from Our Location */
-	FVector Direction = GetOwner()->GetActorLocation() - InteractionComponent->GetComponentLocation();
+	FVector Direction = GetOwner()->GetActorLocation() - InteractionComponent->GetInteractionLocation(Item);
 	Direction.Normalize();
 
 	float DirectionPoint = 0.0f;
 
-	return FVector::DotProduct(Direction, InteractionComponent->GetForwardVector()) > 0.5f;
+	return FVector::DotProduct(Direction, InteractionComponent->GetInteractionForwardVector(Item)) > 0.5f;
 }
 
 void UInteractorComponent::TryStartInteraction()
@@ -132,69 +330,310 @@ void UInteractorComponent::TryStartInteraction()
 	/* Make Sure Interaction Starts on Authority */
 	if (GetInteractorRole() != ROLE_Authority)
 	{
-		Server_TryStartInteraction();
+		uint8 LatencySequence = 0;
+
+		if (UInteractionSubsystem::IsLatencyTelemetryEnabled())
+		{
+			/* Zero is Reserved for Requests Not Measured */
+			LatencyRequestSequence = LatencyRequestSequence % MAX_uint8 + 1;
+			LatencyRequestTime = FPlatformTime::Seconds();
+			LatencySequence = LatencyRequestSequence;
+		}
+
+		Server_TryStartInteraction(LatencySequence);
 		return;
 	}
 
-	/* Prevent New Interaction If One Already In Progress */
-	if (bInteracting)
+	UInteractionRecorderSubsystem* Recorder = UInteractionRecorderSubsystem::GetActiveRecorder(this);
+
+	/* Prevent New Interaction If One Already In Progress or Queued */
+	if (bInteracting || bInteractionQueued)
 	{
+		/* Rejected Against the Interaction In Progress */
+		if (Recorder != nullptr)
+		{
+			Recorder->RecordRequest(this, GetInteractionCandidate(), true);
+		}
+
 		UE_LOG(LogInteractor, Warning, TEXT("Unable to Start Interaction Due to In Progress Interaction"));
 		return;
 	}
 
 	/* Get Server Sided Interaction */
-	if (!TryGetInteraction(InteractionCandidate))
+	UInteractionComponent* Candidate = nullptr;
+	int32 CandidateItem = INDEX_NONE;
+	const bool bFoundInteraction = TryGetInteraction(Candidate, CandidateItem);
+
+	SetInteractionCandidate(Candidate);
+	InteractionItem = CandidateItem;
+
+	/* Record the Target Resolved for this Request, Not the Previous Candidate */
+	if (Recorder != nullptr)
+	{
+		Recorder->RecordRequest(this, bFoundInteraction ? Candidate : nullptr, true);
+	}
+
+	if (!bFoundInteraction)
 	{
 		UE_LOG(LogInteractor, Warning, TEXT("Unable to Start Interaction Due to No Interaction Available On Server Side"));
 		return;
 	}
 
 	/* Start the Interaction */
-	if (InteractionCandidate->CanInteractWith(this) &&
-		CanInteractWith(InteractionCandidate))
+	if (Candidate->CanInteractWith(this) &&
+		CanInteractWith(Candidate))
 	{
 		StartInteraction();
 	}
+	else if (CanInteractWith(Candidate) &&
+		Candidate->TryQueueInteraction(this))
+	{
+		/* Wait In Queue Until Promoted By the Interaction Component */
+		bInteractionQueued = true;
+
+		NotifyInteraction(EInteractionResult::IR_Queued, Candidate->GetInteractionType());
+	}
 	else
 	{
-		NotifyInteraction(EInteractionResult::IR_Failed, InteractionCandidate->GetInteractionType());
+		NotifyInteraction(EInteractionResult::IR_Failed, Candidate->GetInteractionType());
+	}
+}
+
+bool UInteractorComponent::StartQueuedInteraction(UInteractionComponent* QueuedInteraction)
+{
+	/* Validate the Queue Entry Still Matches the Current Candidate */
+	if (!bInteractionQueued || !IsValid(QueuedInteraction) || QueuedInteraction != GetInteractionCandidate())
+	{
+		return false;
+	}
+
+	bInteractionQueued = false;
+
+	/* Conditions May Have Changed While Waiting */
+	if (!QueuedInteraction->CanInteractWith(this) ||
+		!CanInteractWith(QueuedInteraction))
+	{
+		NotifyInteraction(EInteractionResult::IR_Failed, QueuedInteraction->GetInteractionType());
+		return false;
+	}
+
+	StartInteraction();
+
+	return bInteracting;
+}
+
+bool UInteractorComponent::ResumeInteraction(UInteractionComponent* InteractionComponent, int32 Item, float ElapsedTime)
+{
+	if (GetInteractorRole() != ROLE_Authority || bInteracting || bInteractionQueued || !IsValid(InteractionComponent))
+	{
+		return false;
+	}
+
+	SetInteractionCandidate(InteractionComponent);
+	InteractionItem = Item;
+
+	/* Conditions are Validated Again in the New World */
+	if (InteractionComponent->CanInteractWith(this) &&
+		CanInteractWith(InteractionComponent))
+	{
+		StartInteraction(ElapsedTime);
+	}
+
+	/* A Session That Did Not Resume Leaves No Candidate Behind */
+	if (!bInteracting)
+	{
+		SetInteractionCandidate(nullptr);
+		InteractionItem = INDEX_NONE;
 	}
+
+	return bInteracting;
 }
 
-void UInteractorComponent::Server_TryStartInteraction_Implementation()
+FString UInteractorComponent::GetPersistentId() const
 {
+	const AActor* Owner = GetOwner();
+	const APawn* Pawn = Cast<APawn>(Owner);
+	const APlayerState* PlayerState = IsValid(Pawn) ? Pawn->GetPlayerState() : nullptr;
+
+	/* Players Keep their Unique Net Id Across Travel and Migration */
+	if (IsValid(PlayerState) && PlayerState->GetUniqueId().IsValid())
+	{
+		return PlayerState->GetUniqueId().ToString();
+	}
+
+	/* Only Level Placed Actors Have a Name Stable Across Worlds */
+	return IsValid(Owner) && Owner->IsNetStartupActor() ? GetPathName() : FString();
+}
+
+void UInteractorComponent::Server_TryStartInteraction_Implementation(uint8 LatencySequence)
+{
+	/* Drop Excess Requests Before Any Trace or Condition Work */
+	if (!ConsumeServerRequest())
+	{
+		return;
+	}
+
+	if (!UInteractionSubsystem::IsLatencyTelemetryEnabled() || LatencySequence == 0)
+	{
+		TryStartInteraction();
+		return;
+	}
+
+	const uint32 PreviousNotificationCount = NotificationCount;
+	const double RequestTime = FPlatformTime::Seconds();
+
+	/* Only the Synchronous Handling is Timed, Not Queue Waits or Notification Delivery */
 	TryStartInteraction();
+
+	/* The Client Times Until the Next Notification, Which Only Belongs to this Request If One Was Sent */
+	LatencyRequestSequence = NotificationCount != PreviousNotificationCount ? LatencySequence : 0;
+
+	UWorld* World = GetWorld();
+	UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+
+	if (IsValid(InteractionSubsystem))
+	{
+		InteractionSubsystem->RecordLatency(EInteractionLatencyStage::ILS_Server, GetOwner()->GetNetConnection(), (FPlatformTime::Seconds() - RequestTime) * 1000.0);
+	}
+}
+
+void UInteractorComponent::Server_ReportInteractionLatency_Implementation(uint16 LatencyMs, uint8 LatencySequence)
+{
+	/* Discard Samples of Dropped, Unanswered or Already Reported Requests */
+	if (LatencySequence == 0 || LatencySequence != LatencyRequestSequence)
+	{
+		return;
+	}
+
+	LatencyRequestSequence = 0;
+
+	UWorld* World = GetWorld();
+	UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+
+	if (IsValid(InteractionSubsystem) && InteractionSubsystem->bLatencyTelemetry)
+	{
+		InteractionSubsystem->RecordLatency(EInteractionLatencyStage::ILS_RoundTrip, GetOwner()->GetNetConnection(), LatencyMs);
+	}
+}
+
+void UInteractorComponent::ReportRequestLatency()
+{
+	if (LatencyRequestTime <= 0.0)
+	{
+		return;
+	}
+
+	const double LatencyMs = (FPlatformTime::Seconds() - LatencyRequestTime) * 1000.0;
+	LatencyRequestTime = 0.0;
+
+	Server_ReportInteractionLatency(static_cast<uint16>(FMath::Clamp(LatencyMs, 0.0, 65535.0)), LatencyRequestSequence);
 }
 
-void UInteractorComponent::StartInteraction()
+void UInteractorComponent::StartInteraction(float ElapsedTime /* = 0.0f */)
 {
+	UInteractionComponent* Candidate = GetInteractionCandidate();
+	if (!IsValid(Candidate))
+	{
+		return;
+	}
 
 	SetInteracting(true);
 
-	const bool bStarted = InteractionCandidate->StartInteraction(this);
+	/* Begin the Session Before Starting so the Interaction Can Track it */
+	UWorld* World = GetWorld();
+	UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+
+	if (IsValid(InteractionSubsystem))
+	{
+		InteractionSession = InteractionSubsystem->BeginSession(this, Candidate, ElapsedTime);
+	}
+
+	const bool bStarted = Candidate->StartInteraction(this);
 	
 	/* If Failed to Start , Fail Initiation */
 	if (!bStarted)
 	{
 		SetInteracting(false);
+		EndInteractionSession();
 
 		/* Notify Interaction Failed Result */
-		NotifyInteraction(EInteractionResult::IR_Failed, InteractionCandidate->GetInteractionType());
+		NotifyInteraction(EInteractionResult::IR_Failed, Candidate->GetInteractionType());
 
 		return;
 	}
 
 	/* Start Interactor Timer If Interaction Type is Hold */
-	if (InteractionCandidate->GetInteractionType() == EInteractionType::IT_Hold)
+	if (Candidate->GetInteractionType() == EInteractionType::IT_Hold)
 	{
-		UInteractionComponent_Hold* InteractionHold = Cast<UInteractionComponent_Hold>(InteractionCandidate);
+		UInteractionComponent_Hold* InteractionHold = Cast<UInteractionComponent_Hold>(Candidate);
+
+		const float HoldDuration = IsValid(InteractionHold) ? InteractionHold->GetInteractionDuration() : 0.1f;
 
-		ToggleInteractorTimer(true,IsValid(InteractionHold) ? InteractionHold->GetInteractionDuration() : 0.1f);
+		/* Resumed Holds Only Wait For the Remaining Duration */
+		ToggleInteractorTimer(true, FMath::Max(HoldDuration - ElapsedTime, KINDA_SMALL_NUMBER));
+
+		/* Publish the Authoritative Start Time for Client Interpolation */
+		SetHoldProgress(FInteractionHoldProgress(GetServerWorldTime() - ElapsedTime, HoldDuration));
 	}
 
 	/* Notify Interaction Started Result */
-	NotifyInteraction(EInteractionResult::IR_Started, InteractionCandidate->GetInteractionType());
+	NotifyInteraction(EInteractionResult::IR_Started, Candidate->GetInteractionType());
+}
+
+void UInteractorComponent::EndInteractionSession()
+{
+	if (!InteractionSession.IsValid())
+	{
+		return;
+	}
+
+	UWorld* World = GetWorld();
+	UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+
+	if (IsValid(InteractionSubsystem))
+	{
+		InteractionSubsystem->EndSession(InteractionSession);
+	}
+
+	InteractionSession.Reset();
+}
+
+UInteractionComponent* UInteractorComponent::GetInteractionCandidate() const
+{
+	const UInteractionSubsystem* InteractionSubsystem = GetInteractionSubsystem();
+	const FInteractionSession* Focus = IsValid(InteractionSubsystem) ? InteractionSubsystem->FindFocus(CandidateFocus) : nullptr;
+
+	return Focus != nullptr ? Focus->Interaction.Get() : nullptr;
+}
+
+void UInteractorComponent::SetInteractionCandidate(UInteractionComponent* NewCandidate)
+{
+	/* Keep the Focus of an Unchanged Candidate so the Interaction's Handle Stays Valid */
+	if (IsValid(NewCandidate) && NewCandidate == GetInteractionCandidate())
+	{
+		return;
+	}
+
+	UInteractionSubsystem* InteractionSubsystem = GetInteractionSubsystem();
+	if (!IsValid(InteractionSubsystem))
+	{
+		CandidateFocus.Reset();
+		return;
+	}
+
+	InteractionSubsystem->EndFocus(CandidateFocus);
+
+	if (IsValid(NewCandidate))
+	{
+		CandidateFocus = InteractionSubsystem->BeginFocus(this, NewCandidate);
+	}
+}
+
+UInteractionSubsystem* UInteractorComponent::GetInteractionSubsystem() const
+{
+	const UWorld* World = GetWorld();
+
+	return IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
 }
 
 void UInteractorComponent::TryStopInteraction()
@@ -205,26 +644,63 @@ void UInteractorComponent::TryStopInteraction()
 		return;
 	}
 
-	/* Return/Exit If No Interaction in Progress */
-	if (!bInteracting  || !IsValid(InteractionCandidate))
+	/* Return/Exit If No Interaction in Progress or Queued */
+	UInteractionComponent* Candidate = GetInteractionCandidate();
+
+	/* Stops Target the Interaction In Progress or Queued */
+	if (UInteractionRecorderSubsystem* Recorder = UInteractionRecorderSubsystem::GetActiveRecorder(this))
+	{
+		Recorder->RecordRequest(this, bInteracting || bInteractionQueued ? Candidate : nullptr, false);
+	}
+	if ((!bInteracting && !bInteractionQueued) || !IsValid(Candidate))
 	{
 		return;
 	}
 
 	/* Cancel Interaction */
-	InteractionCandidate->StopInteraction(this);
+	Candidate->StopInteraction(this);
 }
 
 void UInteractorComponent::Server_TryStopInteraction_Implementation()
 {
+	/* Stops Ending an Interaction In Progress are Always Accepted to Prevent Stuck Interactions */
+	if (!bInteracting && !bInteractionQueued && !ConsumeServerRequest())
+	{
+		return;
+	}
+
 	TryStopInteraction();
 }
 
+bool UInteractorComponent::ConsumeServerRequest()
+{
+	UWorld* World = GetWorld();
+	if (!IsValid(World))
+	{
+		return true;
+	}
+
+	UNetConnection* Connection = IsValid(GetOwner()) ? GetOwner()->GetNetConnection() : nullptr;
+
+	/* Check the Interactor Bucket First So Rejected Requests Do Not Drain the Connection Bucket */
+	bool bAccepted = ServerRequestBucket.TryConsume(World->GetRealTimeSeconds(), ServerRequestRate, ServerRequestBurst);
+
+	UInteractionSubsystem* InteractionSubsystem = World->GetSubsystem<UInteractionSubsystem>();
+	if (IsValid(InteractionSubsystem))
+	{
+		bAccepted = bAccepted && InteractionSubsystem->ConsumeConnectionRequest(Connection);
+
+		InteractionSubsystem->RecordServerRequest(Connection, bAccepted);
+	}
+
+	return bAccepted;
+}
+
 void UInteractorComponent::EndInteraction(EInteractionResult InteractionResult, UInteractionComponent* InteractionComponent)
 {
 
 	/* Validate Ending Interaction Is Interactor Target Else Fail*/
-	if (InteractionComponent != InteractionCandidate)
+	if (InteractionComponent != GetInteractionCandidate())
 	{
 		UE_LOG(LogInteractor, Warning, TEXT("Unable to Complete/End Interaction Due to Not Matching Interaction Targets"));
 
@@ -233,6 +709,8 @@ void UInteractorComponent::EndInteraction(EInteractionResult InteractionResult,
 
 	/* Set Interacting Status */
 	SetInteracting(false);
+	bInteractionQueued = false;
+	EndInteractionSession();
 
 	/* Get Interaction Type */
 	const EInteractionType EndingInteractionType = IsValid(InteractionComponent) ? InteractionComponent->GetInteractionType() : EInteractionType::IT_None;
@@ -243,6 +721,9 @@ void UInteractorComponent::EndInteraction(EInteractionResult InteractionResult,
 		ToggleInteractorTimer(false);
 	}
 
+	/* Reset Hold Progress */
+	SetHoldProgress(FInteractionHoldProgress());
+
 	/* Notify Interaction Started Result */
 	NotifyInteraction(
 		InteractionResult, 
@@ -252,7 +733,7 @@ void UInteractorComponent::EndInteraction(EInteractionResult InteractionResult,
 
 void UInteractorComponent::LocalEndInteractionFocus(UInteractionComponent* InteractionComponent)
 {
-	if (InteractionComponent == InteractionCandidate && OnNewInteraction.IsBound())
+	if (InteractionComponent == GetInteractionCandidate() && OnNewInteraction.IsBound())
 	{
 		OnNewInteraction.Broadcast(nullptr);
 	}
@@ -268,7 +749,7 @@ bool UInteractorComponent::CanInteractWith(UInteractionComponent* InteractionCom
 		Owner->GetClass()->ImplementsInterface(UInteractionInterface::StaticClass()))
 	{
 
-		return IInteractionInterface::Execute_ICanInteractWith(Owner, InteractionCandidate->GetOwner());
+		return IInteractionInterface::Execute_ICanInteractWith(Owner, InteractionComponent->GetOwner());
 	}
 
 	return true;
@@ -302,7 +783,7 @@ void UInteractorComponent::OnInteractorTimerCompleted()
 {
 	UE_LOG(LogInteractor, Log, TEXT("Interactor Timer Completed"));
 
-	UInteractionComponent_Hold* InteractionHold = Cast<UInteractionComponent_Hold>(InteractionCandidate);
+	UInteractionComponent_Hold* InteractionHold = Cast<UInteractionComponent_Hold>(GetInteractionCandidate());
 
 	/* Validate Interaction Hold Component Is Valid */
 	if (!IsValid(InteractionHold))
@@ -317,6 +798,74 @@ void UInteractorComponent::OnInteractorTimerCompleted()
 	InteractionHold->OnHoldCompleted(this);
 }
 
+void UInteractorComponent::SetInteracting(bool bNewInteracting)
+{
+	if (bInteracting != bNewInteracting)
+	{
+		bInteracting = bNewInteracting;
+
+		MARK_PROPERTY_DIRTY_FROM_NAME(UInteractorComponent, bInteracting, this);
+		UInteractionSoakSubsystem::CountPropertyBytes(this, GET_MEMBER_NAME_CHECKED(UInteractorComponent, bInteracting));
+	}
+
+	if (GetNetMode() != ENetMode::NM_DedicatedServer)
+	{
+		OnRep_bInteracting();
+	}
+}
+
+void UInteractorComponent::SetHoldProgress(const FInteractionHoldProgress& NewHoldProgress)
+{
+	if (HoldProgress != NewHoldProgress)
+	{
+		HoldProgress = NewHoldProgress;
+
+		MARK_PROPERTY_DIRTY_FROM_NAME(UInteractorComponent, HoldProgress, this);
+
+		if (ReplicatesHoldProgress())
+		{
+			UInteractionSoakSubsystem::CountPropertyBytes(this, GET_MEMBER_NAME_CHECKED(UInteractorComponent, HoldProgress));
+		}
+
+		/* Owning Clients Not Receiving the Replicated Progress Get the Exact Server Value */
+		if (!ReplicatesHoldProgress() && !ReceivesOwnerNotifications())
+		{
+			Client_SetHoldProgress(HoldProgress);
+		}
+	}
+}
+
+bool UInteractorComponent::ReplicatesHoldProgress() const
+{
+	const UInteractionComponent* Candidate = GetInteractionCandidate();
+
+	return InteractorStateNetMode == EInteractionNetMode::INM_All ||
+		(IsValid(Candidate) && Candidate->GetStateNetMode() == EInteractionNetMode::INM_All);
+}
+
+void UInteractorComponent::Client_SetHoldProgress_Implementation(const FInteractionHoldProgress& NewHoldProgress)
+{
+	HoldProgress = NewHoldProgress;
+}
+
+float UInteractorComponent::GetServerWorldTime() const
+{
+	const UWorld* World = GetWorld();
+	if (!IsValid(World))
+	{
+		return 0.0f;
+	}
+
+	const AGameStateBase* GameState = World->GetGameState();
+
+	return IsValid(GameState) ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+float UInteractorComponent::GetHoldProgress() const
+{
+	return HoldProgress.GetProgress(GetServerWorldTime());
+}
+
 void UInteractorComponent::OnRep_bInteracting()
 {
 	if (OnInteractingChanged.IsBound())
@@ -325,7 +874,7 @@ void UInteractorComponent::OnRep_bInteracting()
 	}
 }
 
-void UInteractorComponent::RegisterNewInteraction(UInteractionComponent* NewInteraction)
+void UInteractorComponent::RegisterNewInteraction(UInteractionComponent* NewInteraction, int32 NewItem /* = -1 */)
 {
 	if (!IsValid(NewInteraction))
 	{
@@ -334,12 +883,13 @@ void UInteractorComponent::RegisterNewInteraction(UInteractionComponent* NewInte
 	}
 
 	/* Prevent Duplicate Registration */
-	if (InteractionCandidate == NewInteraction)
+	if (GetInteractionCandidate() == NewInteraction && InteractionItem == NewItem)
 	{
 		return;
 	}
 
-	InteractionCandidate = NewInteraction;
+	SetInteractionCandidate(NewInteraction);
+	InteractionItem = NewItem;
 
 	/* Local Interactor */
 	if (IsLocalInteractor())
@@ -355,8 +905,8 @@ void UInteractorComponent::RegisterNewInteraction(UInteractionComponent* NewInte
 
 void UInteractorComponent::DeRegisterInteraction()
 {
-	/* Cancel Interaction If Already Interacting */
-	if (bInteracting)
+	/* Cancel Interaction If Already Interacting or Queued */
+	if (bInteracting || bInteractionQueued)
 	{
 		TryStopInteraction();
 	}
@@ -364,9 +914,9 @@ void UInteractorComponent::DeRegisterInteraction()
 	/* Local Interactor */
 	if (IsLocalInteractor())
 	{
-		if (IsValid(InteractionCandidate))
+		if (UInteractionComponent* Candidate = GetInteractionCandidate())
 		{
-				InteractionCandidate->SetInteractionFocusState(false);
+				Candidate->SetInteractionFocusState(false);
 		}
 
 		if (OnNewInteraction.IsBound())
@@ -375,39 +925,36 @@ void UInteractorComponent::DeRegisterInteraction()
 		}
 	}
 
-	InteractionCandidate = nullptr;
+	SetInteractionCandidate(nullptr);
+	InteractionItem = INDEX_NONE;
 }
 
 void UInteractorComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
-	if (bInteracting)
+	if (bInteracting || bInteractionQueued)
 	{
-		/* If Interacting Get the New Interaction Candidate and Compare to the Current Interacting Component*/
-		const UInteractionComponent* NewInteraction = GetInteractionTrace();
-
-		if (!ValidateDirection(NewInteraction) || NewInteraction != InteractionCandidate)
+		/* Validated by the Interaction Subsystem Parallel Update */
+		if (!bParallelServerUpdate)
 		{
-			/* Cancel Interaction If not Valid Interaction */
-			DeRegisterInteraction();
+			ApplyInteractionValidation(ValidateInteractionInProgress());
 		}
-
 	}
 	else if(IsLocalInteractor())
 	{
 		/* Locally Get Interaction and Validate the Component */
-		UInteractionComponent* NewInteraction = GetInteractionTrace();
+		UInteractionComponent* NewInteraction = GetCoherentInteractionTrace();
 
-		if (ValidateDirection(NewInteraction))
+		if (ValidateDirection(NewInteraction, TraceItem))
 		{
 			/* Register If New Interaction is Not Equal to the Current Candidate */
-			if (NewInteraction != InteractionCandidate)
+			if (NewInteraction != GetInteractionCandidate() || TraceItem != InteractionItem)
 			{
-				RegisterNewInteraction(NewInteraction);
+				RegisterNewInteraction(NewInteraction, TraceItem);
 			}
 		}
-		else if(IsValid(InteractionCandidate))
+		else if(CandidateFocus.IsValid())
 		{
 			/* DeRegister Interaction If No Valid Interaction Component Exits*/
 			DeRegisterInteraction();
@@ -416,54 +963,175 @@ void UInteractorComponent::TickComponent(float DeltaTime, ELevelTick TickType, F
 	}
 }
 
+bool UInteractorComponent::ValidateInteractionInProgress()
+{
+	/* If Interacting Get the New Interaction Candidate and Compare to the Current Interacting Component*/
+	const UInteractionComponent* NewInteraction = GetCoherentInteractionTrace();
+
+	return ValidateDirection(NewInteraction, TraceItem) && NewInteraction == GetInteractionCandidate() && TraceItem == InteractionItem;
+}
+
+void UInteractorComponent::ApplyInteractionValidation(bool bValid)
+{
+	/* Cancel Interaction If not Valid Interaction */
+	if (!bValid && (bInteracting || bInteractionQueued))
+	{
+		DeRegisterInteraction();
+	}
+}
+
 void UInteractorComponent::NotifyInteraction(EInteractionResult NewInteractionResult, EInteractionType NewInteractionType)
 {
+	++NotificationCount;
+
+	if (UInteractionRecorderSubsystem* Recorder = UInteractionRecorderSubsystem::GetActiveRecorder(this))
+	{
+		Recorder->RecordNotification(this, NewInteractionResult, NewInteractionType);
+	}
+
+	if (UInteractionSoakSubsystem* Soak = UInteractionSoakSubsystem::GetActiveSoak(this))
+	{
+		Soak->RecordNotification(NewInteractionResult);
+	}
+
+	/* Coalesce Notifications per Connection Until the End of the Frame */
+	UInteractionSubsystem* Batcher = UInteractionSubsystem::GetNotificationBatcher(this);
+
 	switch (InteractorStateNetMode)
 	{
 	case EInteractionNetMode::INM_OwnerOnly:
-		Client_NotifyInteraction(NewInteractionResult, NewInteractionType);
+		if (Batcher == nullptr || !Batcher->QueueOwnerNotification(this, NewInteractionResult, NewInteractionType))
+		{
+			Client_NotifyInteraction(NewInteractionResult, NewInteractionType);
+		}
 		break;
 	case EInteractionNetMode::INM_All:
-		Multi_NotifyInteraction(NewInteractionResult, NewInteractionType);
+	{
+		/* Owner Outcomes are Reliable, Observer Cosmetics are Unreliable and Sequenced */
+		const uint8 Sequence = ObserverSequence.Next();
+
+		if (Batcher != nullptr)
+		{
+			UNetConnection* OwnerConnection = GetOwner()->GetNetConnection();
+
+			ReportRequestLatency();
+			BroadcastInteractorState(NewInteractionResult, NewInteractionType);
+
+			if (OwnerConnection != nullptr)
+			{
+				Batcher->QueueOwnerNotification(this, NewInteractionResult, NewInteractionType);
+			}
+			else
+			{
+				ForwardInteractionNotification(NewInteractionResult);
+			}
+
+			Batcher->QueueMulticastNotification(this, nullptr, NewInteractionResult, NewInteractionType, 0, Sequence, OwnerConnection);
+		}
+		else
+		{
+			Client_NotifyOwnerInteraction(NewInteractionResult, NewInteractionType);
+
+			/* Observers Must Not Miss the End of an Interaction */
+			if (FInteractionNotificationSequence::IsTerminal(NewInteractionResult))
+			{
+				Multi_NotifyInteractionResult(NewInteractionResult, NewInteractionType, Sequence);
+			}
+			else
+			{
+				Multi_NotifyInteraction(NewInteractionResult, NewInteractionType, Sequence);
+			}
+		}
 		break;
+	}
 	default:
 		break;
 	}
 }
 
+void UInteractorComponent::ReceiveNotification(EInteractionResult NewInteractionResult, EInteractionType NewInteractionType, bool bObserver)
+{
+	if (bObserver)
+	{
+		BroadcastInteractorState(NewInteractionResult, NewInteractionType);
+	}
+	else
+	{
+		Client_NotifyInteraction_Implementation(NewInteractionResult, NewInteractionType);
+	}
+}
+
 void UInteractorComponent::Client_NotifyInteraction_Implementation(EInteractionResult NewInteractionResult, EInteractionType NewInteractionType)
 {
-	if (OnInteractorStateChanged.IsBound())
+	ReportRequestLatency();
+
+	BroadcastInteractorState(NewInteractionResult, NewInteractionType);
+
+	ForwardInteractionNotification(NewInteractionResult);
+}
+
+void UInteractorComponent::ForwardInteractionNotification(EInteractionResult NewInteractionResult)
+{
+	/* Notify Interaction Locally Unless its Net Mode is None */
+	if (UInteractionComponent* Candidate = GetInteractionCandidate())
 	{
+		Candidate->ReceiveOwnerNotification(NewInteractionResult, this);
+	}
+}
 
-		/* Try to Get Interaction Duration If Candidate is a Hold Interaction */
-		float NewInteractionDuration = 0.0f;
+void UInteractorComponent::Client_NotifyOwnerInteraction_Implementation(EInteractionResult NewInteractionResult, EInteractionType NewInteractionType)
+{
+	Client_NotifyInteraction_Implementation(NewInteractionResult, NewInteractionType);
+}
 
-		UInteractionComponent_Hold* InteractionComp_Hold = Cast<UInteractionComponent_Hold>(InteractionCandidate);
+void UInteractorComponent::Multi_NotifyInteraction_Implementation(EInteractionResult NewInteractionResult, EInteractionType NewInteractionType, uint8 Sequence)
+{
+	if (AcceptObserverNotification(Sequence))
+	{
+		BroadcastInteractorState(NewInteractionResult, NewInteractionType);
+	}
+}
 
-		if (IsValid(InteractionComp_Hold))
-		{
-			NewInteractionDuration = InteractionComp_Hold->GetInteractionDuration();
-		}
+void UInteractorComponent::Multi_NotifyInteractionResult_Implementation(EInteractionResult NewInteractionResult, EInteractionType NewInteractionType, uint8 Sequence)
+{
+	Multi_NotifyInteraction_Implementation(NewInteractionResult, NewInteractionType, Sequence);
+}
 
-		/* Broadcast the State */
-		OnInteractorStateChanged.Broadcast(
-			NewInteractionResult,
-			NewInteractionType,
-			NewInteractionDuration,
-			IsValid(InteractionCandidate) ? InteractionCandidate->GetOwner() : nullptr
-		);
+bool UInteractorComponent::AcceptObserverNotification(uint8 Sequence)
+{
+	/* The Owner Already Received the Reliable Notification */
+	if (ReceivesOwnerNotifications())
+	{
+		return false;
 	}
 
-	/* Notify Interaction Locally If Interaction Net Mode is Owner Only*/
-	if (IsValid(InteractionCandidate) &&
-		InteractionCandidate->InteractionStateNetMode == EInteractionNetMode::INM_OwnerOnly)
+	if (GetOwnerRole() != ROLE_Authority && !ObserverSequence.Accept(Sequence))
 	{
-		InteractionCandidate->ClientNotifyInteraction(NewInteractionResult, this);
+		INC_DWORD_STAT(STAT_InteractionStaleNotifications);
+		return false;
 	}
+
+	return true;
+}
+
+bool UInteractorComponent::ReceivesOwnerInteractionState() const
+{
+	return InteractorStateNetMode != EInteractionNetMode::INM_None && ReceivesOwnerNotifications();
+}
+
+bool UInteractorComponent::ReceivesOwnerNotifications() const
+{
+	const AActor* Owner = GetOwner();
+	if (!IsValid(Owner))
+	{
+		return false;
+	}
+
+	/* Client RPCs of Actors Without an Owning Connection Execute on the Server */
+	return Owner->HasLocalNetOwner() || (Owner->GetLocalRole() == ROLE_Authority && Owner->GetNetConnection() == nullptr);
 }
 
-void UInteractorComponent::Multi_NotifyInteraction_Implementation(EInteractionResult NewInteractionResult, EInteractionType NewInteractionType)
+void UInteractorComponent::BroadcastInteractorState(EInteractionResult NewInteractionResult, EInteractionType NewInteractionType)
 {
 	if (OnInteractorStateChanged.IsBound())
 	{
@@ -471,7 +1139,8 @@ void UInteractorComponent::Multi_NotifyInteraction_Implementation(EInteractionRe
 		/* Try to Get Interaction Duration If Candidate is a Hold Interaction */
 		float NewInteractionDuration = 0.0f;
 
-		UInteractionComponent_Hold* InteractionComp_Hold = Cast<UInteractionComponent_Hold>(InteractionCandidate);
+		UInteractionComponent* Candidate = GetInteractionCandidate();
+		UInteractionComponent_Hold* InteractionComp_Hold = Cast<UInteractionComponent_Hold>(Candidate);
 
 		if (IsValid(InteractionComp_Hold))
 		{
@@ -483,7 +1152,7 @@ void UInteractorComponent::Multi_NotifyInteraction_Implementation(EInteractionRe
 			NewInteractionResult,
 			NewInteractionType,
 			NewInteractionDuration,
-			IsValid(InteractionCandidate) ? InteractionCandidate->GetOwner() : nullptr
+			IsValid(Candidate) ? Candidate->GetOwner() : nullptr
 		);
 	}
 }
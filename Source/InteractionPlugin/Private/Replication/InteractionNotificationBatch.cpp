@@ -0,0 +1,73 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "InteractionNotificationBatch.h"
+#include "InteractionComponents/InteractionComponent.h"
+#include "InteractorComponents/InteractorComponent.h"
+#include "InteractionStats.h"
+
+DEFINE_STAT(STAT_InteractionStaleNotifications);
+
+void FInteractionNotification::Deliver() const
+{
+	const bool bObserver = (Flags & INF_Observer) != 0;
+
+	/* Expand Collapsed Transitions so Listeners Still Observe Every State */
+	if (UInteractorComponent* InteractorComponent = Cast<UInteractorComponent>(Component))
+	{
+		if (bObserver && !InteractorComponent->AcceptObserverNotification(Sequence))
+		{
+			return;
+		}
+
+		if (Flags & INF_Started)
+		{
+			InteractorComponent->ReceiveNotification(EInteractionResult::IR_Started, InteractionType, bObserver);
+		}
+
+		InteractorComponent->ReceiveNotification(Result, InteractionType, bObserver);
+	}
+	else if (UInteractionComponent* InteractionComponent = Cast<UInteractionComponent>(Component))
+	{
+		const bool bGroup = (Flags & INF_Group) != 0;
+
+		if (bObserver && !InteractionComponent->AcceptObserverNotification(Sequence, Interactor))
+		{
+			return;
+		}
+
+		if (Flags & INF_Started)
+		{
+			InteractionComponent->ReceiveNotification(EInteractionResult::IR_Started, Interactor, bGroup);
+		}
+
+		InteractionComponent->ReceiveNotification(Result, Interactor, bGroup);
+	}
+}
+
+AInteractionNotificationBatch::AInteractionNotificationBatch()
+{
+	bReplicates = true;
+	bOnlyRelevantToOwner = true;
+	bAlwaysRelevant = false;
+	bNetLoadOnClient = false;
+
+	/* Only Carries RPCs, No Properties to Replicate */
+	NetUpdateFrequency = 1.0f;
+}
+
+void AInteractionNotificationBatch::Client_ReceiveNotifications_Implementation(const TArray<FInteractionNotification>& Notifications)
+{
+	for (const FInteractionNotification& Notification : Notifications)
+	{
+		/* Components Not Yet Replicated to this Client are Skipped, Same as a Missed Multicast */
+		if (IsValid(Notification.Component))
+		{
+			Notification.Deliver();
+		}
+	}
+}
+
+void AInteractionNotificationBatch::Client_ReceiveObserverNotifications_Implementation(const TArray<FInteractionNotification>& Notifications)
+{
+	Client_ReceiveNotifications_Implementation(Notifications);
+}
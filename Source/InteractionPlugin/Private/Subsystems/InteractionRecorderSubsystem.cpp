@@ -0,0 +1,684 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "InteractionRecorderSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "InteractionComponents/InteractionComponent.h"
+#include "InteractorComponents/InteractorComponent.h"
+#include "InteractionStats.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Recorded Traffic Events"), STAT_InteractionRecordedEvents, STATGROUP_Interaction);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Replayed Traffic Events"), STAT_InteractionReplayedEvents, STATGROUP_Interaction);
+
+namespace InteractionRecorder
+{
+	/** Identifies an Interaction Traffic Stream */
+	static const uint32 StreamMagic = 0x43455249;
+
+	/** Version of the Stream Format */
+	static const int32 StreamVersion = 1;
+
+	/** Resolves Relative Stream Names Against the Saved Interaction Directory */
+	static FString ResolveStreamPath(const FString& FileName)
+	{
+		const FString StreamName = FileName.IsEmpty() ? FString(TEXT("Traffic.irec")) : FileName;
+
+		return FPaths::IsRelative(StreamName) ? FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Interaction"), StreamName) : StreamName;
+	}
+
+	/** Returns the Recorder Subsystem of a Console Command World */
+	static UInteractionRecorderSubsystem* GetRecorder(UWorld* World)
+	{
+		return IsValid(World) ? World->GetSubsystem<UInteractionRecorderSubsystem>() : nullptr;
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs InteractionRecordStartCommand(
+	TEXT("Interaction.Record.Start"),
+	TEXT("Starts Recording Server Interaction Traffic. Usage: Interaction.Record.Start [File]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UInteractionRecorderSubsystem* Recorder = InteractionRecorder::GetRecorder(World))
+		{
+			Recorder->StartRecording(InteractionRecorder::ResolveStreamPath(Args.Num() > 0 ? Args[0] : FString()));
+		}
+	})
+);
+
+static FAutoConsoleCommandWithWorldAndArgs InteractionRecordStopCommand(
+	TEXT("Interaction.Record.Stop"),
+	TEXT("Stops Recording Server Interaction Traffic"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UInteractionRecorderSubsystem* Recorder = InteractionRecorder::GetRecorder(World))
+		{
+			Recorder->StopRecording();
+		}
+	})
+);
+
+static FAutoConsoleCommandWithWorldAndArgs InteractionReplayStartCommand(
+	TEXT("Interaction.Replay.Start"),
+	TEXT("Replays Recorded Interaction Traffic Into the Server World. Usage: Interaction.Replay.Start <File> [Speed]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		UInteractionRecorderSubsystem* Recorder = InteractionRecorder::GetRecorder(World);
+
+		if (Recorder != nullptr && Args.Num() > 0)
+		{
+			const float Speed = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 1.0f;
+			Recorder->StartReplay(InteractionRecorder::ResolveStreamPath(Args[0]), Speed);
+		}
+	})
+);
+
+static FAutoConsoleCommandWithWorldAndArgs InteractionReplayStopCommand(
+	TEXT("Interaction.Replay.Stop"),
+	TEXT("Stops the Interaction Traffic Replay"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UInteractionRecorderSubsystem* Recorder = InteractionRecorder::GetRecorder(World))
+		{
+			Recorder->StopReplay();
+		}
+	})
+);
+
+FArchive& operator<<(FArchive& Ar, FInteractionTrafficEvent& Event)
+{
+	uint8 Type = static_cast<uint8>(Event.Type);
+	Ar << Type;
+	Event.Type = static_cast<EInteractionTrafficEvent>(Type);
+
+	Ar << Event.Time;
+	Ar.SerializeIntPacked(Event.InteractorId);
+
+	switch (Event.Type)
+	{
+		case EInteractionTrafficEvent::ITE_DefineInteractor:
+		{
+			Ar << Event.Name;
+			Ar << Event.ReachLength;
+			break;
+		}
+		case EInteractionTrafficEvent::ITE_DefineTarget:
+		{
+			Ar.SerializeIntPacked(Event.TargetId);
+			Ar << Event.Name;
+			break;
+		}
+		case EInteractionTrafficEvent::ITE_TryStart:
+		case EInteractionTrafficEvent::ITE_TryStop:
+		{
+			Ar.SerializeIntPacked(Event.TargetId);
+			Ar << Event.ViewLocation;
+
+			/* Rotation Compressed to Shorts */
+			uint16 Pitch = FRotator::CompressAxisToShort(Event.ViewRotation.Pitch);
+			uint16 Yaw = FRotator::CompressAxisToShort(Event.ViewRotation.Yaw);
+			uint16 Roll = FRotator::CompressAxisToShort(Event.ViewRotation.Roll);
+
+			Ar << Pitch << Yaw << Roll;
+
+			if (Ar.IsLoading())
+			{
+				Event.ViewRotation = FRotator(FRotator::DecompressAxisFromShort(Pitch), FRotator::DecompressAxisFromShort(Yaw), FRotator::DecompressAxisFromShort(Roll));
+			}
+			break;
+		}
+		case EInteractionTrafficEvent::ITE_HoldCompleted:
+		{
+			Ar.SerializeIntPacked(Event.TargetId);
+			break;
+		}
+		case EInteractionTrafficEvent::ITE_Notify:
+		{
+			uint8 Result = static_cast<uint8>(Event.Result);
+			uint8 InteractionType = static_cast<uint8>(Event.InteractionType);
+
+			Ar << Result << InteractionType;
+
+			Event.Result = static_cast<EInteractionResult>(Result);
+			Event.InteractionType = static_cast<EInteractionType>(InteractionType);
+			break;
+		}
+		default:
+		{
+			Ar.SetError();
+			break;
+		}
+	}
+
+	return Ar;
+}
+
+UInteractionRecorderSubsystem::UInteractionRecorderSubsystem()
+	:RecordingWriter(nullptr)
+	,RecordingStartTime(0.0f)
+	,ReplayIndex(0)
+	,ReplayTime(0.0f)
+	,ReplaySpeed(1.0f)
+	,ApplyingEvent(nullptr)
+	,ReplayDivergences(0)
+{
+}
+
+void UInteractionRecorderSubsystem::Deinitialize()
+{
+	StopRecording();
+	StopReplay();
+
+	Super::Deinitialize();
+}
+
+ETickableTickType UInteractionRecorderSubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UInteractionRecorderSubsystem::IsTickable() const
+{
+	return IsReplaying();
+}
+
+TStatId UInteractionRecorderSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractionRecorderSubsystem, STATGROUP_Tickables);
+}
+
+UWorld* UInteractionRecorderSubsystem::GetTickableGameObjectWorld() const
+{
+	return GetWorld();
+}
+
+UInteractionRecorderSubsystem* UInteractionRecorderSubsystem::GetActiveRecorder(const UObject* WorldContextObject)
+{
+	const UWorld* World = IsValid(WorldContextObject) ? WorldContextObject->GetWorld() : nullptr;
+	UInteractionRecorderSubsystem* Recorder = IsValid(World) ? World->GetSubsystem<UInteractionRecorderSubsystem>() : nullptr;
+
+	return Recorder != nullptr && (Recorder->IsRecording() || Recorder->IsReplayActive()) ? Recorder : nullptr;
+}
+
+bool UInteractionRecorderSubsystem::StartRecording(const FString& FileName)
+{
+	StopRecording();
+
+	RecordingWriter = IFileManager::Get().CreateFileWriter(*FileName);
+	if (RecordingWriter == nullptr)
+	{
+		UE_LOG(LogInteraction, Warning, TEXT("Unable to Open Interaction Traffic Stream %s"), *FileName);
+		return false;
+	}
+
+	uint32 Magic = InteractionRecorder::StreamMagic;
+	int32 Version = InteractionRecorder::StreamVersion;
+
+	*RecordingWriter << Magic << Version;
+
+	RecordingStartTime = GetWorld()->GetTimeSeconds();
+
+	UE_LOG(LogInteraction, Log, TEXT("Recording Interaction Traffic to %s"), *FileName);
+	return true;
+}
+
+void UInteractionRecorderSubsystem::StopRecording()
+{
+	if (RecordingWriter == nullptr)
+	{
+		return;
+	}
+
+	RecordingWriter->Close();
+	delete RecordingWriter;
+	RecordingWriter = nullptr;
+
+	InteractorIds.Empty();
+	TargetIds.Empty();
+
+	UE_LOG(LogInteraction, Log, TEXT("Stopped Recording Interaction Traffic"));
+}
+
+float UInteractionRecorderSubsystem::GetRecordingTime() const
+{
+	const UWorld* World = GetWorld();
+
+	return IsValid(World) ? World->GetTimeSeconds() - RecordingStartTime : 0.0f;
+}
+
+void UInteractionRecorderSubsystem::WriteEvent(FInteractionTrafficEvent& Event)
+{
+	Event.Time = GetRecordingTime();
+
+	*RecordingWriter << Event;
+
+	INC_DWORD_STAT(STAT_InteractionRecordedEvents);
+}
+
+uint32 UInteractionRecorderSubsystem::GetInteractorId(UInteractorComponent* InteractorComponent)
+{
+	if (const uint32* ExistingId = InteractorIds.Find(InteractorComponent))
+	{
+		return *ExistingId;
+	}
+
+	const uint32 NewId = InteractorIds.Num() + 1;
+	InteractorIds.Add(InteractorComponent, NewId);
+
+	FInteractionTrafficEvent Event;
+	Event.Type = EInteractionTrafficEvent::ITE_DefineInteractor;
+	Event.InteractorId = NewId;
+	Event.Name = GetNameSafe(InteractorComponent->GetOwner());
+	Event.ReachLength = InteractorComponent->InteractorReachLength;
+
+	WriteEvent(Event);
+
+	return NewId;
+}
+
+uint32 UInteractionRecorderSubsystem::GetTargetId(UInteractionComponent* InteractionComponent)
+{
+	if (!IsValid(InteractionComponent))
+	{
+		return 0;
+	}
+
+	const FString PathName = GetTargetPath(InteractionComponent);
+
+	if (const uint32* ExistingId = TargetIds.Find(PathName))
+	{
+		return *ExistingId;
+	}
+
+	const uint32 NewId = TargetIds.Num() + 1;
+	TargetIds.Add(PathName, NewId);
+
+	FInteractionTrafficEvent Event;
+	Event.Type = EInteractionTrafficEvent::ITE_DefineTarget;
+	Event.TargetId = NewId;
+	Event.Name = PathName;
+
+	WriteEvent(Event);
+
+	return NewId;
+}
+
+FString UInteractionRecorderSubsystem::GetTargetPath(const UInteractionComponent* InteractionComponent)
+{
+	/* Recordings Made in Play In Editor Replay in Other Sessions and Standalone */
+	return IsValid(InteractionComponent) ? UWorld::RemovePIEPrefix(InteractionComponent->GetPathName()) : FString();
+}
+
+void UInteractionRecorderSubsystem::RecordRequest(UInteractorComponent* InteractorComponent, UInteractionComponent* TargetComponent, bool bStart)
+{
+	/* Check the Replayed Request Resolved the Recorded Target */
+	const uint32 ReplayInteractorId = FindReplayInteractorId(InteractorComponent);
+	if (ReplayInteractorId != 0)
+	{
+		if (ApplyingEvent != nullptr)
+		{
+			const FString RecordedPath = ReplayTargetPaths.FindRef(ApplyingEvent->TargetId);
+			const FString ReplayedPath = GetTargetPath(TargetComponent);
+
+			if (RecordedPath != ReplayedPath)
+			{
+				ReportReplayDivergence(ReplayInteractorId, FString::Printf(TEXT("%s Request at %.3f Resolved %s Instead of %s"),
+					bStart ? TEXT("Start") : TEXT("Stop"), ApplyingEvent->Time, ReplayedPath.IsEmpty() ? TEXT("None") : *ReplayedPath, RecordedPath.IsEmpty() ? TEXT("None") : *RecordedPath));
+			}
+		}
+
+		return;
+	}
+
+	const AActor* Owner = IsValid(InteractorComponent) ? InteractorComponent->GetOwner() : nullptr;
+	if (!IsRecording() || !IsValid(Owner))
+	{
+		return;
+	}
+
+	FInteractionTrafficEvent Event;
+	Event.Type = bStart ? EInteractionTrafficEvent::ITE_TryStart : EInteractionTrafficEvent::ITE_TryStop;
+	Event.InteractorId = GetInteractorId(InteractorComponent);
+	Event.TargetId = GetTargetId(TargetComponent);
+
+	Owner->GetActorEyesViewPoint(Event.ViewLocation, Event.ViewRotation);
+
+	WriteEvent(Event);
+}
+
+void UInteractionRecorderSubsystem::RecordHoldCompleted(UInteractorComponent* InteractorComponent, UInteractionComponent* InteractionComponent)
+{
+	const uint32 ReplayInteractorId = FindReplayInteractorId(InteractorComponent);
+	if (ReplayInteractorId != 0)
+	{
+		FInteractionTrafficEvent Outcome;
+		Outcome.Type = EInteractionTrafficEvent::ITE_HoldCompleted;
+		Outcome.InteractorId = ReplayInteractorId;
+		Outcome.Time = ReplayTime;
+		Outcome.Name = GetTargetPath(InteractionComponent);
+
+		AddReplayOutcome(Outcome, false);
+		return;
+	}
+
+	if (!IsRecording() || !IsValid(InteractorComponent))
+	{
+		return;
+	}
+
+	FInteractionTrafficEvent Event;
+	Event.Type = EInteractionTrafficEvent::ITE_HoldCompleted;
+	Event.InteractorId = GetInteractorId(InteractorComponent);
+	Event.TargetId = GetTargetId(InteractionComponent);
+
+	WriteEvent(Event);
+}
+
+void UInteractionRecorderSubsystem::RecordNotification(UInteractorComponent* InteractorComponent, EInteractionResult Result, EInteractionType InteractionType)
+{
+	const uint32 ReplayInteractorId = FindReplayInteractorId(InteractorComponent);
+	if (ReplayInteractorId != 0)
+	{
+		FInteractionTrafficEvent Outcome;
+		Outcome.Type = EInteractionTrafficEvent::ITE_Notify;
+		Outcome.InteractorId = ReplayInteractorId;
+		Outcome.Time = ReplayTime;
+		Outcome.Result = Result;
+		Outcome.InteractionType = InteractionType;
+
+		AddReplayOutcome(Outcome, false);
+		return;
+	}
+
+	if (!IsRecording() || !IsValid(InteractorComponent))
+	{
+		return;
+	}
+
+	FInteractionTrafficEvent Event;
+	Event.Type = EInteractionTrafficEvent::ITE_Notify;
+	Event.InteractorId = GetInteractorId(InteractorComponent);
+	Event.Result = Result;
+	Event.InteractionType = InteractionType;
+
+	WriteEvent(Event);
+}
+
+bool UInteractionRecorderSubsystem::StartReplay(const FString& FileName, float Speed /* = 1.0f */)
+{
+	StopReplay();
+
+	TArray<uint8> StreamData;
+	if (!FFileHelper::LoadFileToArray(StreamData, *FileName))
+	{
+		UE_LOG(LogInteraction, Warning, TEXT("Unable to Load Interaction Traffic Stream %s"), *FileName);
+		return false;
+	}
+
+	FMemoryReader Reader(StreamData);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+
+	Reader << Magic << Version;
+
+	if (Magic != InteractionRecorder::StreamMagic || Version != InteractionRecorder::StreamVersion)
+	{
+		UE_LOG(LogInteraction, Warning, TEXT("Invalid Interaction Traffic Stream %s"), *FileName);
+		return false;
+	}
+
+	while (!Reader.AtEnd())
+	{
+		FInteractionTrafficEvent Event;
+		Reader << Event;
+
+		if (Reader.IsError())
+		{
+			UE_LOG(LogInteraction, Warning, TEXT("Interaction Traffic Stream %s is Truncated, Replaying %d Events"), *FileName, ReplayEvents.Num());
+			break;
+		}
+
+		ReplayEvents.Add(Event);
+	}
+
+	ReplayIndex = 0;
+	ReplayTime = 0.0f;
+	ReplaySpeed = FMath::Max(Speed, KINDA_SMALL_NUMBER);
+	ReplayDivergences = 0;
+
+	UE_LOG(LogInteraction, Log, TEXT("Replaying %d Interaction Traffic Events From %s at %.2fx"), ReplayEvents.Num(), *FileName, ReplaySpeed);
+	return ReplayEvents.Num() > 0;
+}
+
+void UInteractionRecorderSubsystem::StopReplay()
+{
+	/* Outcomes Left Unmatched Were Recorded But Not Replayed or the Other Way Around */
+	for (const TPair<uint32, TArray<FInteractionTrafficEvent>>& Outcomes : RecordedOutcomes)
+	{
+		for (const FInteractionTrafficEvent& Outcome : Outcomes.Value)
+		{
+			ReportReplayDivergence(Outcomes.Key, FString::Printf(TEXT("Recorded Outcome at %.3f Was Not Replayed"), Outcome.Time));
+		}
+	}
+
+	for (const TPair<uint32, TArray<FInteractionTrafficEvent>>& Outcomes : ReplayedOutcomes)
+	{
+		for (const FInteractionTrafficEvent& Outcome : Outcomes.Value)
+		{
+			ReportReplayDivergence(Outcomes.Key, FString::Printf(TEXT("Replayed Outcome at %.3f Was Not Recorded"), Outcome.Time));
+		}
+	}
+
+	if (ReplayInteractors.Num() > 0)
+	{
+		UE_LOG(LogInteraction, Log, TEXT("Interaction Traffic Replay Stopped With %d Divergences"), ReplayDivergences);
+	}
+
+	ReplayEvents.Empty();
+	ReplayReachLengths.Empty();
+	ReplayTargetPaths.Empty();
+	ReplayInteractorIds.Empty();
+	RecordedOutcomes.Empty();
+	ReplayedOutcomes.Empty();
+	ReplayIndex = 0;
+
+	for (const TPair<uint32, UInteractorComponent*>& ReplayInteractor : ReplayInteractors)
+	{
+		if (IsValid(ReplayInteractor.Value) && IsValid(ReplayInteractor.Value->GetOwner()))
+		{
+			ReplayInteractor.Value->GetOwner()->Destroy();
+		}
+	}
+
+	ReplayInteractors.Empty();
+}
+
+void UInteractionRecorderSubsystem::Tick(float DeltaTime)
+{
+	ReplayTime += DeltaTime * ReplaySpeed;
+
+	/* Feed Every Event Due by the Scaled Replay Time */
+	while (ReplayEvents.IsValidIndex(ReplayIndex) && ReplayEvents[ReplayIndex].Time <= ReplayTime)
+	{
+		ApplyReplayEvent(ReplayEvents[ReplayIndex]);
+		++ReplayIndex;
+
+		INC_DWORD_STAT(STAT_InteractionReplayedEvents);
+	}
+
+	/* Keep the Replay Interactors Until Stopped so Interactions In Progress Can Complete */
+	if (ReplayIndex >= ReplayEvents.Num())
+	{
+		UE_LOG(LogInteraction, Log, TEXT("Interaction Traffic Replay Finished Feeding Events With %d Divergences So Far, Stop it to Check Pending Outcomes"), ReplayDivergences);
+
+		ReplayEvents.Empty();
+		ReplayIndex = 0;
+	}
+}
+
+void UInteractionRecorderSubsystem::ApplyReplayEvent(const FInteractionTrafficEvent& Event)
+{
+	switch (Event.Type)
+	{
+		case EInteractionTrafficEvent::ITE_DefineInteractor:
+		{
+			ReplayReachLengths.Add(Event.InteractorId, Event.ReachLength);
+			break;
+		}
+		case EInteractionTrafficEvent::ITE_DefineTarget:
+		{
+			ReplayTargetPaths.Add(Event.TargetId, Event.Name);
+			break;
+		}
+		case EInteractionTrafficEvent::ITE_TryStart:
+		case EInteractionTrafficEvent::ITE_TryStop:
+		{
+			UInteractorComponent* InteractorComponent = GetReplayInteractor(Event.InteractorId);
+			if (!IsValid(InteractorComponent))
+			{
+				break;
+			}
+
+			/* Replay Actors Use their Transform as the View Point */
+			InteractorComponent->GetOwner()->SetActorLocationAndRotation(Event.ViewLocation, Event.ViewRotation, false, nullptr, ETeleportType::TeleportPhysics);
+
+			/* The Request Hook Checks the Resolved Target Against the Recorded One */
+			ApplyingEvent = &Event;
+
+			if (Event.Type == EInteractionTrafficEvent::ITE_TryStart)
+			{
+				InteractorComponent->TryStartInteraction();
+			}
+			else
+			{
+				InteractorComponent->TryStopInteraction();
+			}
+
+			ApplyingEvent = nullptr;
+			break;
+		}
+		case EInteractionTrafficEvent::ITE_HoldCompleted:
+		{
+			/* Outcomes are Produced Again by the Replayed Requests, Match Them Against the Recorded Ones */
+			FInteractionTrafficEvent Outcome = Event;
+			Outcome.Name = ReplayTargetPaths.FindRef(Event.TargetId);
+
+			AddReplayOutcome(Outcome, true);
+			break;
+		}
+		case EInteractionTrafficEvent::ITE_Notify:
+		{
+			AddReplayOutcome(Event, true);
+			break;
+		}
+		default:
+		{
+			break;
+		}
+	}
+}
+
+uint32 UInteractionRecorderSubsystem::FindReplayInteractorId(const UInteractorComponent* InteractorComponent) const
+{
+	const uint32* InteractorId = IsReplayActive() ? ReplayInteractorIds.Find(InteractorComponent) : nullptr;
+
+	return InteractorId != nullptr ? *InteractorId : 0;
+}
+
+void UInteractionRecorderSubsystem::AddReplayOutcome(const FInteractionTrafficEvent& Outcome, bool bRecorded)
+{
+	TArray<FInteractionTrafficEvent>& Recorded = RecordedOutcomes.FindOrAdd(Outcome.InteractorId);
+	TArray<FInteractionTrafficEvent>& Replayed = ReplayedOutcomes.FindOrAdd(Outcome.InteractorId);
+
+	(bRecorded ? Recorded : Replayed).Add(Outcome);
+
+	/* Replayed Timers Drift From the Recorded Ones, Outcomes are Matched in Order Rather Than by Time */
+	const int32 NumMatched = FMath::Min(Recorded.Num(), Replayed.Num());
+
+	for (int32 Index = 0; Index < NumMatched; ++Index)
+	{
+		CompareReplayOutcomes(Recorded[Index], Replayed[Index]);
+	}
+
+	Recorded.RemoveAt(0, NumMatched, false);
+	Replayed.RemoveAt(0, NumMatched, false);
+}
+
+void UInteractionRecorderSubsystem::CompareReplayOutcomes(const FInteractionTrafficEvent& Recorded, const FInteractionTrafficEvent& Replayed)
+{
+	if (Recorded.Type != Replayed.Type)
+	{
+		ReportReplayDivergence(Recorded.InteractorId, FString::Printf(TEXT("Recorded %s at %.3f Was Replayed as %s"),
+			Recorded.Type == EInteractionTrafficEvent::ITE_Notify ? TEXT("Notification") : TEXT("Hold Completion"), Recorded.Time,
+			Replayed.Type == EInteractionTrafficEvent::ITE_Notify ? TEXT("Notification") : TEXT("Hold Completion")));
+		return;
+	}
+
+	if (Recorded.Type == EInteractionTrafficEvent::ITE_HoldCompleted && Recorded.Name != Replayed.Name)
+	{
+		ReportReplayDivergence(Recorded.InteractorId, FString::Printf(TEXT("Hold Completed at %.3f on %s Instead of %s"), Recorded.Time, *Replayed.Name, *Recorded.Name));
+	}
+	else if (Recorded.Type == EInteractionTrafficEvent::ITE_Notify && (Recorded.Result != Replayed.Result || Recorded.InteractionType != Replayed.InteractionType))
+	{
+		const UEnum* ResultEnum = StaticEnum<EInteractionResult>();
+
+		ReportReplayDivergence(Recorded.InteractorId, FString::Printf(TEXT("Notification at %.3f Was %s Instead of %s"), Recorded.Time,
+			*ResultEnum->GetNameStringByValue(static_cast<int64>(Replayed.Result)), *ResultEnum->GetNameStringByValue(static_cast<int64>(Recorded.Result))));
+	}
+}
+
+void UInteractionRecorderSubsystem::ReportReplayDivergence(uint32 InteractorId, const FString& Description)
+{
+	++ReplayDivergences;
+
+	UE_LOG(LogInteraction, Warning, TEXT("Interaction Replay Diverged for Interactor %u: %s"), InteractorId, *Description);
+}
+
+UInteractorComponent* UInteractionRecorderSubsystem::GetReplayInteractor(uint32 InteractorId)
+{
+	if (UInteractorComponent** ExistingInteractor = ReplayInteractors.Find(InteractorId))
+	{
+		return *ExistingInteractor;
+	}
+
+	UWorld* World = GetWorld();
+	if (!IsValid(World))
+	{
+		return nullptr;
+	}
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	SpawnParameters.ObjectFlags |= RF_Transient;
+
+	AActor* ReplayActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParameters);
+	if (!IsValid(ReplayActor))
+	{
+		return nullptr;
+	}
+
+	USceneComponent* RootComponent = NewObject<USceneComponent>(ReplayActor, TEXT("ReplayRoot"));
+	ReplayActor->SetRootComponent(RootComponent);
+	RootComponent->RegisterComponent();
+
+	/* Requests are Replayed As Recorded, Without Rate Limiting or Notifications */
+	UInteractorComponent* InteractorComponent = NewObject<UInteractorComponent>(ReplayActor, TEXT("ReplayInteractor"));
+	InteractorComponent->InteractorStateNetMode = EInteractionNetMode::INM_None;
+	InteractorComponent->ServerRequestRate = 0.0f;
+
+	if (const float* ReachLength = ReplayReachLengths.Find(InteractorId))
+	{
+		InteractorComponent->InteractorReachLength = *ReachLength;
+	}
+
+	InteractorComponent->RegisterComponent();
+
+	ReplayInteractors.Add(InteractorId, InteractorComponent);
+	ReplayInteractorIds.Add(InteractorComponent, InteractorId);
+	return InteractorComponent;
+}
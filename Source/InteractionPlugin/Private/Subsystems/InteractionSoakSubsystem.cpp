@@ -0,0 +1,630 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "InteractionSoakSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetConnection.h"
+#include "Engine/Channel.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Paths.h"
+#include "Net/DataBunch.h"
+#include "HAL/PlatformProcess.h"
+#include "InteractionComponents/InteractionComponent.h"
+#include "InteractorComponents/InteractorComponent.h"
+#include "Replication/InteractionNotificationBatch.h"
+
+/* Split Screen Supports at Most Four Local Players */
+static const int32 MaxSoakLocalPlayers = 4;
+
+/* Object References Replicate as a Network GUID, Estimated at 32 Bits */
+static const int64 SoakObjectReferenceBits = 32;
+
+/* Dynamic Arrays Replicate their Element Count First */
+static const int64 SoakArrayCountBits = 16;
+
+static int64 GetSoakValueBits(const FProperty* Property, const void* Value);
+
+/**
+ * Returns the Replicated Payload Bits of the Properties of a Struct or the Parameters of a Function
+ */
+static int64 GetSoakContainerBits(const UStruct* Struct, const void* Container, bool bParameters)
+{
+	int64 Bits = 0;
+
+	for (TFieldIterator<FProperty> It(Struct); It; ++It)
+	{
+		if (bParameters ? (It->PropertyFlags & (CPF_Parm | CPF_ReturnParm)) != CPF_Parm : It->HasAnyPropertyFlags(CPF_RepSkip))
+		{
+			continue;
+		}
+
+		for (int32 Index = 0; Index < It->ArrayDim; ++Index)
+		{
+			Bits += GetSoakValueBits(*It, It->ContainerPtrToValuePtr<void>(Container, Index));
+		}
+	}
+
+	return Bits;
+}
+
+/**
+ * Returns the Replicated Payload Bits of a Single Property Value
+ */
+static int64 GetSoakValueBits(const FProperty* Property, const void* Value)
+{
+	if (Property->IsA<FBoolProperty>())
+	{
+		return 1;
+	}
+
+	if (Property->IsA<FObjectPropertyBase>() || Property->IsA<FInterfaceProperty>())
+	{
+		return SoakObjectReferenceBits;
+	}
+
+	if (const FArrayProperty* ArrayProperty = CastField<FArrayProperty>(Property))
+	{
+		FScriptArrayHelper ArrayHelper(ArrayProperty, Value);
+		int64 Bits = SoakArrayCountBits;
+
+		for (int32 Index = 0; Index < ArrayHelper.Num(); ++Index)
+		{
+			Bits += GetSoakValueBits(ArrayProperty->Inner, ArrayHelper.GetRawPtr(Index));
+		}
+		return Bits;
+	}
+
+	if (const FStructProperty* StructProperty = CastField<FStructProperty>(Property))
+	{
+		/* Native Serializers Referencing Objects Need a Package Map, Walk their Members Instead */
+		const UScriptStruct* Struct = StructProperty->Struct;
+		if (!(Struct->StructFlags & STRUCT_NetSerializeNative) || Struct->RefLink != nullptr)
+		{
+			return GetSoakContainerBits(Struct, Value, false);
+		}
+	}
+
+	FNetBitWriter Writer(nullptr, 0);
+	Property->NetSerializeItem(Writer, nullptr, const_cast<void*>(Value));
+
+	return Writer.GetNumBits();
+}
+
+static FAutoConsoleCommandWithWorldAndArgs InteractionSoakStartCommand(
+	TEXT("Interaction.Soak.Start"),
+	TEXT("Starts an Interaction Soak Run. Usage: Interaction.Soak.Start [Seconds] [PktLoss] [PktLag]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		UInteractionSoakSubsystem* Soak = IsValid(World) ? World->GetSubsystem<UInteractionSoakSubsystem>() : nullptr;
+
+		if (Soak != nullptr)
+		{
+			const float Duration = Args.Num() > 0 ? FCString::Atof(*Args[0]) : 0.0f;
+			const int32 PacketLoss = Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 0;
+			const int32 PacketLag = Args.Num() > 2 ? FCString::Atoi(*Args[2]) : 0;
+
+			Soak->StartSoak(Duration, PacketLoss, PacketLag);
+		}
+	})
+);
+
+static FAutoConsoleCommandWithWorldAndArgs InteractionSoakStopCommand(
+	TEXT("Interaction.Soak.Stop"),
+	TEXT("Ends the Interaction Soak Run and Reports the Metrics"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		UInteractionSoakSubsystem* Soak = IsValid(World) ? World->GetSubsystem<UInteractionSoakSubsystem>() : nullptr;
+
+		if (Soak != nullptr && Soak->IsSoaking())
+		{
+			Soak->StopSoak();
+		}
+	})
+);
+
+UInteractionSoakSubsystem::UInteractionSoakSubsystem()
+	:RequestsPerSecond(1.0f)
+	,MaxHoldTime(3.0f)
+	,ViewJitter(10.0f)
+	,MinConnections(1)
+	,MaxAverageFrameMs(0.0f)
+	,MaxBytesPerInteraction(0.0f)
+	,MaxReliableBuffer(0)
+	,MaxFailureRate(0.0f)
+	,bSoaking(false)
+	,bExitWhenDone(false)
+	,SoakDuration(0.0f)
+	,SoakTime(0.0f)
+	,LocalPlayerCount(1)
+	,bCountingRPCs(false)
+	,SampledFrames(0)
+	,TotalFrameMs(0.0)
+	,InteractionBitsSent(0)
+{
+}
+
+void UInteractionSoakSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	float Duration = 0.0f;
+	if (!InWorld.IsGameWorld() || !FParse::Value(FCommandLine::Get(), TEXT("InteractionSoak="), Duration))
+	{
+		return;
+	}
+
+	int32 PacketLoss = 0;
+	int32 PacketLag = 0;
+
+	FParse::Value(FCommandLine::Get(), TEXT("InteractionSoakPktLoss="), PacketLoss);
+	FParse::Value(FCommandLine::Get(), TEXT("InteractionSoakPktLag="), PacketLag);
+
+	/* Each Client Drives One Interactor per Local Player */
+	int32 Players = 1;
+	FParse::Value(FCommandLine::Get(), TEXT("InteractionSoakPlayers="), Players);
+	LocalPlayerCount = FMath::Clamp(Players, 1, MaxSoakLocalPlayers);
+
+	/* Command Line Runs are Unattended, Exit With the Budget Result */
+	bExitWhenDone = true;
+
+	StartSoak(Duration, PacketLoss, PacketLag);
+
+	if (InWorld.GetNetMode() != NM_Client)
+	{
+		LaunchClients(Duration, PacketLoss, PacketLag);
+	}
+}
+
+ETickableTickType UInteractionSoakSubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UInteractionSoakSubsystem::IsTickable() const
+{
+	return bSoaking;
+}
+
+TStatId UInteractionSoakSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractionSoakSubsystem, STATGROUP_Tickables);
+}
+
+UWorld* UInteractionSoakSubsystem::GetTickableGameObjectWorld() const
+{
+	return GetWorld();
+}
+
+UInteractionSoakSubsystem* UInteractionSoakSubsystem::GetActiveSoak(const UObject* WorldContextObject)
+{
+	const UWorld* World = IsValid(WorldContextObject) ? WorldContextObject->GetWorld() : nullptr;
+	UInteractionSoakSubsystem* Soak = IsValid(World) ? World->GetSubsystem<UInteractionSoakSubsystem>() : nullptr;
+
+	return Soak != nullptr && Soak->IsSoaking() ? Soak : nullptr;
+}
+
+void UInteractionSoakSubsystem::StartSoak(float Duration, int32 PacketLoss /* = 0 */, int32 PacketLag /* = 0 */)
+{
+	UWorld* World = GetWorld();
+	if (!IsValid(World))
+	{
+		return;
+	}
+
+	bSoaking = true;
+	SoakDuration = Duration;
+	SoakTime = 0.0f;
+	StopCountdowns.Reset();
+	SampledFrames = 0;
+	TotalFrameMs = 0.0;
+	InteractionBitsSent = 0;
+	Report = FInteractionSoakReport();
+
+#if DO_ENABLE_NET_TEST
+	/* Simulate Bad Networks on Both Ends */
+	if (UNetDriver* NetDriver = World->GetNetDriver())
+	{
+		FPacketSimulationSettings PacketSettings = NetDriver->PacketSimulationSettings;
+		PacketSettings.PktLoss = PacketLoss;
+		PacketSettings.PktLag = PacketLag;
+
+		NetDriver->SetPacketSimulationSettings(PacketSettings);
+	}
+#endif
+
+#if !UE_BUILD_SHIPPING
+	/* Only the Server Counts Interaction RPC Payloads, Without Replacing a Counter Already Installed */
+	UNetDriver* NetDriver = World->GetNetDriver();
+	if (NetDriver != nullptr && World->GetNetMode() != NM_Client)
+	{
+		if (NetDriver->SendRPCDel.IsBound())
+		{
+			UE_LOG(LogInteraction, Warning, TEXT("Interaction Soak: the Net Driver Already Has an RPC Counter, Interaction RPC Bytes Will Not be Measured"));
+		}
+		else
+		{
+			NetDriver->SendRPCDel.BindUObject(this, &UInteractionSoakSubsystem::OnSendRPC);
+			bCountingRPCs = true;
+		}
+	}
+#endif
+
+	if (World->GetNetMode() == NM_Client)
+	{
+		CreateLocalPlayers();
+	}
+
+	UE_LOG(LogInteraction, Log, TEXT("Interaction Soak Started: Duration %.1fs, PktLoss %d%%, PktLag %dms"), Duration, PacketLoss, PacketLag);
+}
+
+bool UInteractionSoakSubsystem::StopSoak()
+{
+	bSoaking = false;
+
+	UWorld* World = GetWorld();
+	const bool bServer = IsValid(World) && World->GetNetMode() != NM_Client;
+
+#if !UE_BUILD_SHIPPING
+	UNetDriver* NetDriver = IsValid(World) ? World->GetNetDriver() : nullptr;
+	if (bCountingRPCs && NetDriver != nullptr)
+	{
+		NetDriver->SendRPCDel.Unbind();
+	}
+#endif
+	bCountingRPCs = false;
+
+	/* Every Launched Client Must Have Connected */
+	const int32 RequiredConnections = FMath::Max(MinConnections, LaunchedClients.Num());
+	ReleaseClients();
+
+	Report.Duration = SoakTime;
+	Report.AverageFrameMs = SampledFrames > 0 ? static_cast<float>(TotalFrameMs / SampledFrames) : 0.0f;
+	Report.BytesPerInteraction = Report.StartedCount > 0 ? static_cast<float>(InteractionBitsSent) / 8.0f / Report.StartedCount : 0.0f;
+
+	const int32 Attempts = Report.StartedCount + Report.FailedCount;
+	Report.FailureRate = Attempts > 0 ? static_cast<float>(Report.FailedCount) / Attempts : 0.0f;
+
+	bool bPassed = true;
+
+	/* Only the Server Measures, Clients Just Drive Traffic */
+	if (bServer)
+	{
+		UE_LOG(LogInteraction, Log, TEXT("Interaction Soak Report: %.1fs, %d Connections, Frame %.2fms Avg %.2fms Max, %.1f Bytes/Interaction, Reliable High Water %d, Started %d, Failed %d, Interrupted %d, Failure Rate %.3f"),
+			Report.Duration, Report.PeakConnections, Report.AverageFrameMs, Report.MaxFrameMs, Report.BytesPerInteraction, Report.ReliableBufferHighWater,
+			Report.StartedCount, Report.FailedCount, Report.InterruptedCount, Report.FailureRate);
+
+		/* A Run Without Traffic Measures Nothing */
+		if (Report.PeakConnections < RequiredConnections)
+		{
+			UE_LOG(LogInteraction, Error, TEXT("Interaction Soak Failed: %d Connections < %d Required"), Report.PeakConnections, RequiredConnections);
+			bPassed = false;
+		}
+
+		if (Report.StartedCount == 0)
+		{
+			UE_LOG(LogInteraction, Error, TEXT("Interaction Soak Failed: No Interaction Started"));
+			bPassed = false;
+		}
+
+		if (MaxAverageFrameMs > 0.0f && Report.AverageFrameMs > MaxAverageFrameMs)
+		{
+			UE_LOG(LogInteraction, Error, TEXT("Interaction Soak Budget Exceeded: Average Frame %.2fms > %.2fms"), Report.AverageFrameMs, MaxAverageFrameMs);
+			bPassed = false;
+		}
+
+		if (MaxBytesPerInteraction > 0.0f && Report.BytesPerInteraction > MaxBytesPerInteraction)
+		{
+			UE_LOG(LogInteraction, Error, TEXT("Interaction Soak Budget Exceeded: %.1f Bytes/Interaction > %.1f"), Report.BytesPerInteraction, MaxBytesPerInteraction);
+			bPassed = false;
+		}
+
+		if (MaxReliableBuffer > 0 && Report.ReliableBufferHighWater > MaxReliableBuffer)
+		{
+			UE_LOG(LogInteraction, Error, TEXT("Interaction Soak Budget Exceeded: Reliable High Water %d > %d"), Report.ReliableBufferHighWater, MaxReliableBuffer);
+			bPassed = false;
+		}
+
+		if (MaxFailureRate > 0.0f && Report.FailureRate > MaxFailureRate)
+		{
+			UE_LOG(LogInteraction, Error, TEXT("Interaction Soak Budget Exceeded: Failure Rate %.3f > %.3f"), Report.FailureRate, MaxFailureRate);
+			bPassed = false;
+		}
+
+		UE_LOG(LogInteraction, Log, TEXT("Interaction Soak %s"), bPassed ? TEXT("Passed") : TEXT("Failed"));
+	}
+
+	if (bExitWhenDone)
+	{
+		FPlatformMisc::RequestExitWithStatus(false, bPassed ? 0 : 1);
+	}
+
+	return bPassed;
+}
+
+void UInteractionSoakSubsystem::RecordNotification(EInteractionResult Result)
+{
+	switch (Result)
+	{
+	case EInteractionResult::IR_Started:
+		++Report.StartedCount;
+		break;
+	case EInteractionResult::IR_Failed:
+		++Report.FailedCount;
+		break;
+	case EInteractionResult::IR_Interrupted:
+		++Report.InterruptedCount;
+		break;
+	default:
+		break;
+	}
+}
+
+void UInteractionSoakSubsystem::CountPropertyBytes(const UObject* Object, FName PropertyName)
+{
+	UInteractionSoakSubsystem* Soak = GetActiveSoak(Object);
+	if (Soak == nullptr || !Soak->bCountingRPCs)
+	{
+		return;
+	}
+
+	const FProperty* Property = FindFProperty<FProperty>(Object->GetClass(), PropertyName);
+	if (Property == nullptr)
+	{
+		return;
+	}
+
+	int64 Bits = 0;
+	for (int32 Index = 0; Index < Property->ArrayDim; ++Index)
+	{
+		Bits += GetSoakValueBits(Property, Property->ContainerPtrToValuePtr<void>(Object, Index));
+	}
+
+	const UActorComponent* Component = Cast<UActorComponent>(Object);
+	Soak->AddInteractionBits(Component != nullptr ? Component->GetOwner() : Cast<AActor>(Object), Bits, false);
+}
+
+void UInteractionSoakSubsystem::CountItemBytes(const UObject* Object, const UScriptStruct* ItemStruct, const void* ItemData)
+{
+	UInteractionSoakSubsystem* Soak = GetActiveSoak(Object);
+	if (Soak == nullptr || !Soak->bCountingRPCs || ItemStruct == nullptr)
+	{
+		return;
+	}
+
+	const UActorComponent* Component = Cast<UActorComponent>(Object);
+	Soak->AddInteractionBits(Component != nullptr ? Component->GetOwner() : Cast<AActor>(Object), GetSoakContainerBits(ItemStruct, ItemData, false), false);
+}
+
+void UInteractionSoakSubsystem::OnSendRPC(AActor* Actor, UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack, UObject* SubObject, bool& bBlockSendRPC)
+{
+	if (!bSoaking || Function == nullptr || !Function->HasAnyFunctionFlags(FUNC_NetClient | FUNC_NetMulticast))
+	{
+		return;
+	}
+
+	/* Only RPCs Declared by the Interaction Classes Count */
+	const UClass* FunctionClass = Function->GetOwnerClass();
+	if (FunctionClass == nullptr || !(FunctionClass->IsChildOf(UInteractorComponent::StaticClass())
+		|| FunctionClass->IsChildOf(UInteractionComponent::StaticClass())
+		|| FunctionClass->IsChildOf(AInteractionNotificationBatch::StaticClass())))
+	{
+		return;
+	}
+
+	AddInteractionBits(Actor, GetSoakContainerBits(Function, Parameters, true), Function->HasAnyFunctionFlags(FUNC_NetClient));
+}
+
+void UInteractionSoakSubsystem::AddInteractionBits(const AActor* Actor, int64 Bits, bool bOwnerOnly)
+{
+	if (!IsValid(Actor))
+	{
+		return;
+	}
+
+	InteractionBitsSent += bOwnerOnly ? Bits : Bits * GetNumReplicatingConnections(Actor);
+}
+
+int32 UInteractionSoakSubsystem::GetNumReplicatingConnections(const AActor* Actor) const
+{
+	const UWorld* World = GetWorld();
+	const UNetDriver* NetDriver = IsValid(World) ? World->GetNetDriver() : nullptr;
+
+	if (NetDriver == nullptr)
+	{
+		return 0;
+	}
+
+	const TWeakObjectPtr<AActor> WeakActor(const_cast<AActor*>(Actor));
+	int32 Count = 0;
+
+	for (UNetConnection* Connection : NetDriver->ClientConnections)
+	{
+		if (Connection != nullptr && Connection->FindActorChannelRef(WeakActor) != nullptr)
+		{
+			++Count;
+		}
+	}
+
+	return Count;
+}
+
+void UInteractionSoakSubsystem::Tick(float DeltaTime)
+{
+	SoakTime += DeltaTime;
+
+	const UWorld* World = GetWorld();
+
+	if (World->GetNetMode() != NM_Client)
+	{
+		SampleServerMetrics(DeltaTime);
+	}
+
+	if (World->GetNetMode() != NM_DedicatedServer)
+	{
+		DriveLocalInteractors(DeltaTime);
+	}
+
+	if (SoakDuration > 0.0f && SoakTime >= SoakDuration)
+	{
+		StopSoak();
+	}
+}
+
+void UInteractionSoakSubsystem::DriveLocalInteractors(float DeltaTime)
+{
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		APlayerController* PlayerController = It->Get();
+		APawn* Pawn = IsValid(PlayerController) && PlayerController->IsLocalController() ? PlayerController->GetPawn() : nullptr;
+		UInteractorComponent* InteractorComponent = IsValid(Pawn) ? Pawn->FindComponentByClass<UInteractorComponent>() : nullptr;
+
+		if (IsValid(InteractorComponent))
+		{
+			DriveInteractor(PlayerController, InteractorComponent, DeltaTime);
+		}
+	}
+}
+
+void UInteractionSoakSubsystem::DriveInteractor(APlayerController* PlayerController, UInteractorComponent* InteractorComponent, float DeltaTime)
+{
+	float& StopCountdown = StopCountdowns.FindOrAdd(InteractorComponent);
+
+	/* Hold the Current Interaction for a Random Time */
+	if (StopCountdown > 0.0f)
+	{
+		StopCountdown -= DeltaTime;
+
+		if (StopCountdown <= 0.0f)
+		{
+			InteractorComponent->TryStopInteraction();
+		}
+		return;
+	}
+
+	if (FMath::FRand() >= RequestsPerSecond * DeltaTime)
+	{
+		return;
+	}
+
+	/* Look Around So Requests Hit Different Interactions and Miss Some */
+	FRotator ControlRotation = PlayerController->GetControlRotation();
+	ControlRotation.Yaw += FMath::FRandRange(-ViewJitter, ViewJitter);
+	PlayerController->SetControlRotation(ControlRotation);
+
+	InteractorComponent->TryStartInteraction();
+	StopCountdown = FMath::FRandRange(KINDA_SMALL_NUMBER, FMath::Max(MaxHoldTime, KINDA_SMALL_NUMBER));
+}
+
+void UInteractionSoakSubsystem::CreateLocalPlayers()
+{
+	UGameInstance* GameInstance = GetWorld()->GetGameInstance();
+	if (!IsValid(GameInstance))
+	{
+		return;
+	}
+
+	/* Extra Local Players Join the Server as Split Screen Players of the Same Connection */
+	while (GameInstance->GetNumLocalPlayers() < LocalPlayerCount)
+	{
+		FString Error;
+		if (GameInstance->CreateLocalPlayer(-1, Error, true) == nullptr)
+		{
+			UE_LOG(LogInteraction, Warning, TEXT("Interaction Soak: Failed to Create a Local Player: %s"), *Error);
+			break;
+		}
+	}
+}
+
+void UInteractionSoakSubsystem::LaunchClients(float Duration, int32 PacketLoss, int32 PacketLag)
+{
+	int32 Clients = 0;
+	if (!FParse::Value(FCommandLine::Get(), TEXT("InteractionSoakClients="), Clients) || Clients <= 0)
+	{
+		return;
+	}
+
+	const UWorld* World = GetWorld();
+
+	/* Uncooked Builds Run the Editor Executable, Which Needs the Project */
+	FString Params;
+	if (!FPlatformProperties::RequiresCookedData() && FPaths::IsProjectFilePathSet())
+	{
+		Params = FString::Printf(TEXT("\"%s\" "), *FPaths::ConvertRelativePathToFull(FPaths::GetProjectFilePath()));
+	}
+
+	Params += FString::Printf(TEXT("127.0.0.1:%d -game -nullrhi -nosound -unattended -InteractionSoak=%f -InteractionSoakPktLoss=%d -InteractionSoakPktLag=%d -InteractionSoakPlayers=%d"),
+		World->URL.Port, Duration, PacketLoss, PacketLag, LocalPlayerCount);
+
+	for (int32 Index = 0; Index < Clients; ++Index)
+	{
+		const FString ClientParams = FString::Printf(TEXT("%s -log=InteractionSoakClient%d.log"), *Params, Index);
+		FProcHandle Handle = FPlatformProcess::CreateProc(FPlatformProcess::ExecutablePath(), *ClientParams, true, true, true, nullptr, 0, nullptr, nullptr);
+
+		if (Handle.IsValid())
+		{
+			LaunchedClients.Add(Handle);
+		}
+		else
+		{
+			UE_LOG(LogInteraction, Error, TEXT("Interaction Soak: Failed to Launch Client %d"), Index);
+		}
+	}
+
+	UE_LOG(LogInteraction, Log, TEXT("Interaction Soak Launched %d of %d Clients With %d Players Each"), LaunchedClients.Num(), Clients, LocalPlayerCount);
+}
+
+void UInteractionSoakSubsystem::ReleaseClients()
+{
+	for (FProcHandle& Handle : LaunchedClients)
+	{
+		/* Clients Would Otherwise Fall Back to their Default Map Once the Server Leaves */
+		if (FPlatformProcess::IsProcRunning(Handle))
+		{
+			FPlatformProcess::TerminateProc(Handle);
+		}
+
+		FPlatformProcess::CloseProc(Handle);
+	}
+
+	LaunchedClients.Reset();
+}
+
+void UInteractionSoakSubsystem::SampleServerMetrics(float DeltaTime)
+{
+	/* Game Thread Work Excludes the Time Spent Idling for the Server Tick Rate */
+	const float FrameMs = FMath::Max(static_cast<float>(FApp::GetDeltaTime() - FApp::GetIdleTime()), 0.0f) * 1000.0f;
+
+	TotalFrameMs += FrameMs;
+	++SampledFrames;
+	Report.MaxFrameMs = FMath::Max(Report.MaxFrameMs, FrameMs);
+
+	const UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+	if (NetDriver == nullptr)
+	{
+		return;
+	}
+
+	Report.PeakConnections = FMath::Max(Report.PeakConnections, NetDriver->ClientConnections.Num());
+
+	for (const UNetConnection* Connection : NetDriver->ClientConnections)
+	{
+		if (Connection == nullptr)
+		{
+			continue;
+		}
+
+		for (const UChannel* Channel : Connection->OpenChannels)
+		{
+			if (Channel != nullptr)
+			{
+				Report.ReliableBufferHighWater = FMath::Max(Report.ReliableBufferHighWater, Channel->NumOutRec);
+			}
+		}
+	}
+}
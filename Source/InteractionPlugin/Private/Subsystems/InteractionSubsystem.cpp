@@ -0,0 +1,1288 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "InteractionSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/NetConnection.h"
+#include "GameFramework/Actor.h"
+#include "InteractionComponents/InteractionComponent.h"
+#include "InteractorComponents/InteractorComponent.h"
+#include "Engine/NetDriver.h"
+#include "Async/ParallelFor.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Engine/AssetManager.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "InteractionStats.h"
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Server Requests Accepted"), STAT_InteractionServerRequestsAccepted, STATGROUP_Interaction);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Server Requests Dropped"), STAT_InteractionServerRequestsDropped, STATGROUP_Interaction);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Registered Interactions"), STAT_InteractionRegistered, STATGROUP_Interaction);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Interaction Records"), STAT_InteractionRecords, STATGROUP_Interaction);
+
+DECLARE_CYCLE_STAT(TEXT("Tag Query"), STAT_InteractionTagQuery, STATGROUP_Interaction);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Tag Indexed Interactions"), STAT_InteractionTagIndexed, STATGROUP_Interaction);
+
+DECLARE_CYCLE_STAT(TEXT("Parallel Server Update"), STAT_InteractionParallelServerUpdate, STATGROUP_Interaction);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Parallel Validated Interactors"), STAT_InteractionParallelValidated, STATGROUP_Interaction);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Interaction Sessions"), STAT_InteractionSessions, STATGROUP_Interaction);
+
+DECLARE_CYCLE_STAT(TEXT("Capture Snapshot"), STAT_InteractionCaptureSnapshot, STATGROUP_Interaction);
+DECLARE_CYCLE_STAT(TEXT("Restore Snapshot"), STAT_InteractionRestoreSnapshot, STATGROUP_Interaction);
+
+/* Seconds Between Scans For Sessions Left Behind by Destroyed Components */
+static const float SessionPruneInterval = 1.0f;
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Batched Notifications"), STAT_InteractionBatchedNotifications, STATGROUP_Interaction);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Collapsed Notifications"), STAT_InteractionCollapsedNotifications, STATGROUP_Interaction);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Notification Batches Sent"), STAT_InteractionNotificationBatches, STATGROUP_Interaction);
+
+DECLARE_CYCLE_STAT(TEXT("Feedback Prefetch"), STAT_InteractionFeedbackPrefetch, STATGROUP_Interaction);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Prefetched Interactions"), STAT_InteractionPrefetched, STATGROUP_Interaction);
+
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Round Trip Latency P50 (ms)"), STAT_InteractionRoundTripP50, STATGROUP_Interaction);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Round Trip Latency P95 (ms)"), STAT_InteractionRoundTripP95, STATGROUP_Interaction);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Round Trip Latency P99 (ms)"), STAT_InteractionRoundTripP99, STATGROUP_Interaction);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Server Latency P50 (ms)"), STAT_InteractionServerP50, STATGROUP_Interaction);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Server Latency P95 (ms)"), STAT_InteractionServerP95, STATGROUP_Interaction);
+DECLARE_FLOAT_ACCUMULATOR_STAT(TEXT("Server Latency P99 (ms)"), STAT_InteractionServerP99, STATGROUP_Interaction);
+
+static FAutoConsoleCommandWithWorld InteractionLatencyCommand(
+	TEXT("Interaction.Latency"),
+	TEXT("Logs the Interaction Latency Percentiles"),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr)
+		{
+			InteractionSubsystem->LogLatency();
+		}
+	})
+);
+
+static FAutoConsoleCommandWithWorldAndArgs InteractionLatencyDumpCommand(
+	TEXT("Interaction.Latency.Dump"),
+	TEXT("Writes the Interaction Latency Percentiles to Saved/Interaction. Usage: Interaction.Latency.Dump [json|csv]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr)
+		{
+			InteractionSubsystem->DumpLatency(Args.Num() > 0 && Args[0] == TEXT("csv"));
+		}
+	})
+);
+
+static FAutoConsoleCommandWithWorld InteractionLatencyResetCommand(
+	TEXT("Interaction.Latency.Reset"),
+	TEXT("Clears the Interaction Latency Histograms"),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		if (UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr)
+		{
+			InteractionSubsystem->ResetLatency();
+		}
+	})
+);
+
+namespace InteractionSnapshot
+{
+	/** Identifies Interaction Snapshot Data */
+	constexpr uint32 Magic = 0x49534E50;
+
+	/** Version of the Snapshot Layout, Snapshots of Other Versions are Rejected */
+	constexpr int32 Version = 1;
+
+	/** Returns the Path Snapshots are Saved to by the Console Commands */
+	FString GetSnapshotPath()
+	{
+		return FPaths::ProjectSavedDir() / TEXT("Interaction") / TEXT("InteractionSnapshot.bin");
+	}
+}
+
+static FAutoConsoleCommandWithWorld InteractionSnapshotSaveCommand(
+	TEXT("Interaction.Snapshot.Save"),
+	TEXT("Writes a Snapshot of the Interaction Sessions and State to Saved/Interaction"),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+
+		TArray<uint8> Data;
+		if (IsValid(InteractionSubsystem) && InteractionSubsystem->CaptureSnapshot(Data) >= 0)
+		{
+			FFileHelper::SaveArrayToFile(Data, *InteractionSnapshot::GetSnapshotPath());
+		}
+	})
+);
+
+static FAutoConsoleCommandWithWorld InteractionSnapshotRestoreCommand(
+	TEXT("Interaction.Snapshot.Restore"),
+	TEXT("Restores the Interaction Snapshot Saved to Saved/Interaction"),
+	FConsoleCommandWithWorldDelegate::CreateStatic([](UWorld* World)
+	{
+		UInteractionSubsystem* InteractionSubsystem = IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+
+		TArray<uint8> Data;
+		if (IsValid(InteractionSubsystem) && FFileHelper::LoadFileToArray(Data, *InteractionSnapshot::GetSnapshotPath()))
+		{
+			InteractionSubsystem->RestoreSnapshot(Data);
+		}
+	})
+);
+
+UInteractionSubsystem::UInteractionSubsystem()
+	:InteractionTraceChannel(ECC_Visibility)
+	,bProxiesBlockVisibility(false)
+	,TagIndexCellSize(2000.0f)
+	,ConnectionRequestRate(20.0f)
+	,ConnectionRequestBurst(10.0f)
+	,bParallelServerUpdate(false)
+	,MinParallelInteractors(16)
+	,bBatchNotifications(false)
+	,MaxHeldNotifications(128)
+	,bPrefetchFeedbackAssets(false)
+	,PrefetchRadius(2000.0f)
+	,PrefetchReleaseRadius(2500.0f)
+	,PrefetchInterval(0.25f)
+	,bLatencyTelemetry(false)
+	,LatencyDumpInterval(0.0f)
+	,bLatencyDumpCsv(false)
+	,SnapshotResumeTimeout(30.0f)
+	,PendingResumeExpireTime(0.0f)
+	,LastPrefetchTime(0.0f)
+	,LastSessionPruneTime(0.0f)
+	,LastLatencyDumpTime(0.0f)
+	,AcceptedRequestCount(0)
+	,DroppedRequestCount(0)
+{
+}
+
+void UInteractionSubsystem::Deinitialize()
+{
+	ConnectionRequestStates.Empty();
+	RegisteredInteractions.Empty();
+	RegistryIndices.Empty();
+	TagIndex.Reset();
+	SET_DWORD_STAT(STAT_InteractionTagIndexed, 0);
+	InteractionRecords.Empty();
+	RecordLevels.Empty();
+	ServerInteractors.Empty();
+	ActiveServerInteractors.Empty();
+	ServerInteractorResults.Empty();
+
+	for (const TPair<TWeakObjectPtr<UInteractionComponent>, TSharedPtr<FStreamableHandle>>& PrefetchHandle : PrefetchHandles)
+	{
+		if (PrefetchHandle.Value.IsValid())
+		{
+			PrefetchHandle.Value->ReleaseHandle();
+		}
+	}
+
+	PrefetchHandles.Empty();
+	SET_DWORD_STAT(STAT_InteractionPrefetched, 0);
+
+	NotificationBatches.Empty();
+
+	Sessions.Reset();
+	Focuses.Reset();
+	SET_DWORD_STAT(STAT_InteractionSessions, 0);
+	ResetPendingResumes();
+
+	Super::Deinitialize();
+}
+
+ETickableTickType UInteractionSubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool UInteractionSubsystem::IsTickable() const
+{
+	/* Open Sessions and Focuses Keep the Subsystem Ticking So Stale Ones are Pruned */
+	return PendingResumes.Num() > 0 || ServerInteractors.Num() > 0 || Sessions.Num() > 0 || Focuses.Num() > 0 || bLatencyTelemetry || bPrefetchFeedbackAssets || NotificationBatches.Num() > 0;
+}
+
+TStatId UInteractionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInteractionSubsystem, STATGROUP_Tickables);
+}
+
+UWorld* UInteractionSubsystem::GetTickableGameObjectWorld() const
+{
+	return GetWorld();
+}
+
+void UInteractionSubsystem::Tick(float DeltaTime)
+{
+	PruneSessions();
+	ResumePendingSessions();
+	UpdateServerInteractors();
+
+	if (bLatencyTelemetry)
+	{
+		UpdateLatencyTelemetry();
+	}
+
+	if (bPrefetchFeedbackAssets)
+	{
+		UpdateFeedbackPrefetch();
+	}
+
+	/* Tickables Run After Actor Ticks and Before the Net Driver Flush */
+	FlushNotifications();
+}
+
+FInteractionHandle UInteractionSubsystem::BeginSession(UInteractorComponent* InteractorComponent, UInteractionComponent* InteractionComponent, float ElapsedTime /* = 0.0f */)
+{
+	const UWorld* World = GetWorld();
+
+	INC_DWORD_STAT(STAT_InteractionSessions);
+
+	return Sessions.Add(InteractorComponent, InteractionComponent, (IsValid(World) ? World->GetTimeSeconds() : 0.0f) - ElapsedTime);
+}
+
+int32 UInteractionSubsystem::CaptureSnapshot(TArray<uint8>& OutData)
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionCaptureSnapshot);
+
+	const UWorld* World = GetWorld();
+	if (!IsValid(World) || World->GetNetMode() == NM_Client)
+	{
+		return INDEX_NONE;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const float CurrentTime = World->GetTimeSeconds();
+
+	OutData.Reset();
+	FMemoryWriter Writer(OutData);
+
+	uint32 Magic = InteractionSnapshot::Magic;
+	int32 Version = InteractionSnapshot::Version;
+	Writer << Magic << Version;
+
+	/* Counts are Patched Once Known to Write Everything in a Single Pass */
+	int32 NumRecords = 0;
+	const int64 NumRecordsOffset = Writer.Tell();
+	Writer << NumRecords;
+
+	for (TPair<FName, FInteractionRecord>& Record : InteractionRecords)
+	{
+		Writer << Record.Key << Record.Value;
+		++NumRecords;
+	}
+
+	FInteractionRecord Record;
+	ForEachInteraction([&Writer, &Record, &NumRecords](UInteractionComponent* InteractionComponent)
+	{
+		FName PersistentId = InteractionComponent->GetPersistentId();
+
+		if (!PersistentId.IsNone())
+		{
+			InteractionComponent->WriteInteractionRecord(Record);
+			Writer << PersistentId << Record;
+			++NumRecords;
+		}
+	});
+
+	int32 NumSessions = 0;
+	const int64 NumSessionsOffset = Writer.Tell();
+	Writer << NumSessions;
+
+	FInteractionSessionSnapshot SessionSnapshot;
+	Sessions.ForEach([&Writer, &SessionSnapshot, &NumSessions, CurrentTime](FInteractionHandle Handle, const FInteractionSession& Session)
+	{
+		if (!Session.IsAlive())
+		{
+			return;
+		}
+
+		SessionSnapshot.InteractorId = Session.Interactor->GetPersistentId();
+		SessionSnapshot.InteractionId = Session.Interaction->GetPersistentId();
+
+		/* Sessions of Spawned Interactions or Anonymous Interactors Can't be Matched in Another World */
+		if (SessionSnapshot.InteractorId.IsEmpty() || SessionSnapshot.InteractionId.IsNone())
+		{
+			return;
+		}
+
+		SessionSnapshot.Item = Session.Interactor->GetInteractionItem();
+		SessionSnapshot.ElapsedTime = CurrentTime - Session.StartTime;
+
+		Writer << SessionSnapshot;
+		++NumSessions;
+	});
+
+	const int64 EndOffset = Writer.Tell();
+
+	Writer.Seek(NumRecordsOffset);
+	Writer << NumRecords;
+	Writer.Seek(NumSessionsOffset);
+	Writer << NumSessions;
+	Writer.Seek(EndOffset);
+
+	UE_LOG(LogInteraction, Log, TEXT("Captured Interaction Snapshot of %d Records and %d Sessions, %d Bytes in %.2f ms"), NumRecords, NumSessions, OutData.Num(), (FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+	return NumSessions;
+}
+
+bool UInteractionSubsystem::RestoreSnapshot(const TArray<uint8>& Data)
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionRestoreSnapshot);
+
+	const UWorld* World = GetWorld();
+	if (!IsValid(World) || World->GetNetMode() == NM_Client)
+	{
+		return false;
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	FMemoryReader Reader(Data);
+
+	uint32 Magic = 0;
+	int32 Version = 0;
+	Reader << Magic << Version;
+
+	if (Reader.IsError() || Magic != InteractionSnapshot::Magic || Version != InteractionSnapshot::Version)
+	{
+		UE_LOG(LogInteraction, Warning, TEXT("Unable to Restore Interaction Snapshot Due to Invalid Data or Version %d, Expected %d"), Version, InteractionSnapshot::Version);
+		return false;
+	}
+
+	int32 NumRecords = 0;
+	Reader << NumRecords;
+
+	TMap<FName, FInteractionRecord> Records;
+	Records.Reserve(FMath::Clamp(NumRecords, 0, Data.Num()));
+
+	for (int32 Index = 0; Index < NumRecords && !Reader.IsError(); ++Index)
+	{
+		FName PersistentId;
+		Reader << PersistentId;
+		Reader << Records.FindOrAdd(PersistentId);
+	}
+
+	int32 NumSessions = 0;
+	Reader << NumSessions;
+
+	TArray<FInteractionSessionSnapshot> RestoredSessions;
+	RestoredSessions.Reserve(FMath::Clamp(NumSessions, 0, Data.Num()));
+
+	for (int32 Index = 0; Index < NumSessions && !Reader.IsError(); ++Index)
+	{
+		Reader << RestoredSessions.AddDefaulted_GetRef();
+	}
+
+	if (Reader.IsError())
+	{
+		UE_LOG(LogInteraction, Warning, TEXT("Unable to Restore Interaction Snapshot Due to Truncated Data"));
+		return false;
+	}
+
+	/* Interactions Already In Play are Restored Now, the Others When they Register */
+	ForEachInteraction([&Records](UInteractionComponent* InteractionComponent)
+	{
+		FInteractionRecord Record;
+		if (Records.RemoveAndCopyValue(InteractionComponent->GetPersistentId(), Record))
+		{
+			InteractionComponent->ReadInteractionRecord(Record);
+		}
+	});
+
+	for (TPair<FName, FInteractionRecord>& Record : Records)
+	{
+		FindOrAddInteractionRecord(Record.Key) = MoveTemp(Record.Value);
+	}
+
+	PendingResumes.Append(MoveTemp(RestoredSessions));
+	PendingResumeExpireTime = World->GetTimeSeconds() + SnapshotResumeTimeout;
+
+	/* Resolve the Interactions In Play Once, the Others are Resolved When they Register */
+	for (const FInteractionSessionSnapshot& SessionSnapshot : PendingResumes)
+	{
+		PendingResumeInteractions.FindOrAdd(SessionSnapshot.InteractionId);
+		PendingResumeLevels.Add(GetRecordLevel(SessionSnapshot.InteractionId));
+	}
+
+	ForEachInteraction([this](UInteractionComponent* InteractionComponent)
+	{
+		AddPendingResumeInteraction(InteractionComponent);
+	});
+
+	ResumePendingSessions();
+
+	UE_LOG(LogInteraction, Log, TEXT("Restored Interaction Snapshot of %d Records and %d Sessions in %.2f ms, %d Sessions Waiting to Resume"), NumRecords, NumSessions, (FPlatformTime::Seconds() - StartTime) * 1000.0, PendingResumes.Num());
+
+	return true;
+}
+
+void UInteractionSubsystem::ResumePendingSessions()
+{
+	UWorld* World = GetWorld();
+	if (PendingResumes.Num() == 0 || !IsValid(World))
+	{
+		return;
+	}
+
+	if (World->GetTimeSeconds() > PendingResumeExpireTime)
+	{
+		UE_LOG(LogInteraction, Warning, TEXT("Dropped %d Restored Interaction Sessions Whose Interactor or Interaction Never Entered Play"), PendingResumes.Num());
+
+		ResetPendingResumes();
+		return;
+	}
+
+	/* Players are Matched by Unique Net Id Once they Possess a Pawn */
+	TMap<FString, UInteractorComponent*> PlayerInteractors;
+
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PlayerController = It->Get();
+		const APawn* Pawn = IsValid(PlayerController) ? PlayerController->GetPawn() : nullptr;
+		UInteractorComponent* InteractorComponent = IsValid(Pawn) ? Pawn->FindComponentByClass<UInteractorComponent>() : nullptr;
+
+		if (IsValid(InteractorComponent))
+		{
+			PlayerInteractors.Add(InteractorComponent->GetPersistentId(), InteractorComponent);
+		}
+	}
+
+	for (int32 Index = PendingResumes.Num() - 1; Index >= 0; --Index)
+	{
+		const FInteractionSessionSnapshot& SessionSnapshot = PendingResumes[Index];
+
+		/* Level Placed Interactors are Identified by Path */
+		UInteractorComponent* InteractorComponent = SessionSnapshot.InteractorId.StartsWith(TEXT("/")) ?
+			FindObject<UInteractorComponent>(nullptr, *SessionSnapshot.InteractorId) :
+			PlayerInteractors.FindRef(SessionSnapshot.InteractorId);
+
+		if (!IsValid(InteractorComponent) || !InteractorComponent->HasBegunPlay())
+		{
+			continue;
+		}
+
+		UInteractionComponent* InteractionComponent = PendingResumeInteractions.FindRef(SessionSnapshot.InteractionId).Get();
+		if (!IsValid(InteractionComponent))
+		{
+			continue;
+		}
+
+		if (!InteractorComponent->ResumeInteraction(InteractionComponent, SessionSnapshot.Item, SessionSnapshot.ElapsedTime))
+		{
+			UE_LOG(LogInteraction, Warning, TEXT("Unable to Resume Interaction Session of %s"), *SessionSnapshot.InteractorId);
+		}
+
+		PendingResumes.RemoveAtSwap(Index);
+	}
+
+	if (PendingResumes.Num() == 0)
+	{
+		ResetPendingResumes();
+	}
+}
+
+void UInteractionSubsystem::AddPendingResumeInteraction(UInteractionComponent* InteractionComponent)
+{
+	if (!PendingResumeLevels.Contains(InteractionComponent->GetOutermost()->GetFName()))
+	{
+		return;
+	}
+
+	if (TWeakObjectPtr<UInteractionComponent>* PendingResumeInteraction = PendingResumeInteractions.Find(InteractionComponent->GetPersistentId()))
+	{
+		*PendingResumeInteraction = InteractionComponent;
+	}
+}
+
+void UInteractionSubsystem::ResetPendingResumes()
+{
+	PendingResumes.Empty();
+	PendingResumeInteractions.Empty();
+	PendingResumeLevels.Empty();
+}
+
+void UInteractionSubsystem::ForEachInteraction(TFunctionRef<void(UInteractionComponent*)> Callback) const
+{
+	for (UInteractionComponent* InteractionComponent : RegisteredInteractions)
+	{
+		if (IsValid(InteractionComponent))
+		{
+			Callback(InteractionComponent);
+		}
+	}
+}
+
+void UInteractionSubsystem::EndSession(FInteractionHandle& Handle)
+{
+	if (Sessions.Remove(Handle))
+	{
+		DEC_DWORD_STAT(STAT_InteractionSessions);
+	}
+
+	Handle.Reset();
+}
+
+FInteractionHandle UInteractionSubsystem::BeginFocus(UInteractorComponent* InteractorComponent, UInteractionComponent* InteractionComponent)
+{
+	const UWorld* World = GetWorld();
+
+	return Focuses.Add(InteractorComponent, InteractionComponent, IsValid(World) ? World->GetTimeSeconds() : 0.0f);
+}
+
+void UInteractionSubsystem::EndFocus(FInteractionHandle& Handle)
+{
+	Focuses.Remove(Handle);
+	Handle.Reset();
+}
+
+void UInteractionSubsystem::PruneSessions()
+{
+	/* Stale Sessions Only Hold a Slot, Amortize the Scan Over the Prune Interval */
+	const float CurrentTime = GetWorld()->GetRealTimeSeconds();
+	if (CurrentTime - LastSessionPruneTime < SessionPruneInterval)
+	{
+		return;
+	}
+
+	LastSessionPruneTime = CurrentTime;
+
+	/* Components Destroyed Mid Interaction Leave their Sessions Behind, Release the Slots */
+	TArray<FInteractionHandle, TInlineAllocator<8>> DeadHandles;
+
+	Sessions.ForEach([&DeadHandles](FInteractionHandle Handle, const FInteractionSession& Session)
+	{
+		if (!Session.IsAlive())
+		{
+			DeadHandles.Add(Handle);
+		}
+	});
+
+	for (FInteractionHandle& Handle : DeadHandles)
+	{
+		EndSession(Handle);
+	}
+
+	DeadHandles.Reset();
+
+	Focuses.ForEach([&DeadHandles](FInteractionHandle Handle, const FInteractionSession& Focus)
+	{
+		if (!Focus.IsAlive())
+		{
+			DeadHandles.Add(Handle);
+		}
+	});
+
+	for (FInteractionHandle& Handle : DeadHandles)
+	{
+		Focuses.Remove(Handle);
+	}
+}
+
+UInteractionSubsystem* UInteractionSubsystem::GetNotificationBatcher(const UObject* WorldContextObject)
+{
+	const UWorld* World = IsValid(WorldContextObject) ? WorldContextObject->GetWorld() : nullptr;
+	if (!IsValid(World) || World->GetNetMode() == NM_Standalone || World->GetNetMode() == NM_Client)
+	{
+		return nullptr;
+	}
+
+	UInteractionSubsystem* InteractionSubsystem = World->GetSubsystem<UInteractionSubsystem>();
+
+	return InteractionSubsystem != nullptr && InteractionSubsystem->bBatchNotifications ? InteractionSubsystem : nullptr;
+}
+
+bool UInteractionSubsystem::QueueOwnerNotification(UInteractorComponent* InteractorComponent, EInteractionResult Result, EInteractionType InteractionType, uint8 Flags)
+{
+	UNetConnection* Connection = IsValid(InteractorComponent) && IsValid(InteractorComponent->GetOwner()) ? InteractorComponent->GetOwner()->GetNetConnection() : nullptr;
+	if (Connection == nullptr)
+	{
+		return false;
+	}
+
+	FInteractionNotification Notification;
+	Notification.Component = InteractorComponent;
+	Notification.Result = Result;
+	Notification.InteractionType = InteractionType;
+	Notification.Flags = Flags;
+
+	QueueNotification(NotificationBatches.FindOrAdd(Connection).Pending, Notification);
+	return true;
+}
+
+void UInteractionSubsystem::QueueMulticastNotification(UActorComponent* Component, UInteractorComponent* InteractorComponent, EInteractionResult Result, EInteractionType InteractionType, uint8 Flags, uint8 Sequence, UNetConnection* OwnerConnection)
+{
+	const UWorld* World = GetWorld();
+	UNetDriver* NetDriver = IsValid(World) ? World->GetNetDriver() : nullptr;
+	AActor* Owner = IsValid(Component) ? Component->GetOwner() : nullptr;
+
+	if (NetDriver == nullptr || !IsValid(Owner))
+	{
+		return;
+	}
+
+	FInteractionNotification Notification;
+	Notification.Component = Component;
+	Notification.Interactor = InteractorComponent;
+	Notification.Result = Result;
+	Notification.InteractionType = InteractionType;
+	Notification.Flags = Flags | INF_Observer;
+	Notification.Sequence = Sequence;
+
+	/* Only Connections the Owner is Replicated To, Same as a Multicast */
+	for (UNetConnection* Connection : NetDriver->ClientConnections)
+	{
+		if (Connection == nullptr || Connection == OwnerConnection || Connection->FindActorChannelRef(Owner) == nullptr)
+		{
+			continue;
+		}
+
+		FConnectionNotificationBatch& Batch = NotificationBatches.FindOrAdd(Connection);
+
+		/* Observers Must Not Miss the End of an Interaction, Terminal Results Go to the Reliable Batch */
+		if (!FInteractionNotificationSequence::IsTerminal(Result))
+		{
+			QueueNotification(Batch.PendingObservers, Notification);
+			continue;
+		}
+
+		/* Collapse the Unreliable Started Notification of the Same Frame Into the Terminal One */
+		FInteractionNotification TerminalNotification = Notification;
+
+		const int32 StartedIndex = Batch.PendingObservers.FindLastByPredicate([Component](const FInteractionNotification& Queued) { return Queued.Component == Component; });
+		if (StartedIndex != INDEX_NONE)
+		{
+			const FInteractionNotification& Started = Batch.PendingObservers[StartedIndex];
+
+			if (Started.Result == EInteractionResult::IR_Started && Started.Interactor == InteractorComponent && Started.Flags == Notification.Flags)
+			{
+				Batch.PendingObservers.RemoveAt(StartedIndex);
+				TerminalNotification.Flags |= INF_Started;
+
+				INC_DWORD_STAT(STAT_InteractionCollapsedNotifications);
+			}
+		}
+
+		QueueNotification(Batch.Pending, TerminalNotification);
+	}
+}
+
+void UInteractionSubsystem::QueueNotification(TArray<FInteractionNotification>& Pending, const FInteractionNotification& Notification)
+{
+	INC_DWORD_STAT(STAT_InteractionBatchedNotifications);
+
+	/* Collapse a Terminal Result Into the Started Notification of the Same Component Queued This Frame */
+	if (FInteractionNotificationSequence::IsTerminal(Notification.Result))
+	{
+		for (int32 Index = Pending.Num() - 1; Index >= 0; --Index)
+		{
+			FInteractionNotification& Queued = Pending[Index];
+
+			if (Queued.Component != Notification.Component)
+			{
+				continue;
+			}
+
+			if (Queued.Result == EInteractionResult::IR_Started && Queued.Interactor == Notification.Interactor && Queued.Flags == Notification.Flags)
+			{
+				Queued.Result = Notification.Result;
+				Queued.Sequence = Notification.Sequence;
+				Queued.Flags |= INF_Started;
+
+				INC_DWORD_STAT(STAT_InteractionCollapsedNotifications);
+				return;
+			}
+
+			break;
+		}
+	}
+
+	Pending.Add(Notification);
+}
+
+void UInteractionSubsystem::FlushNotifications()
+{
+	UWorld* World = GetWorld();
+
+	for (auto It = NotificationBatches.CreateIterator(); It; ++It)
+	{
+		UNetConnection* Connection = It.Key().Get();
+		FConnectionNotificationBatch& Batch = It.Value();
+
+		if (Connection == nullptr || !IsValid(World) || Connection->State == USOCK_Closed)
+		{
+			if (AInteractionNotificationBatch* Channel = Batch.Channel.Get())
+			{
+				Channel->Destroy();
+			}
+
+			It.RemoveCurrent();
+			continue;
+		}
+
+		if (Batch.Pending.Num() == 0 && Batch.PendingObservers.Num() == 0)
+		{
+			continue;
+		}
+
+		/* Spawn the Owner Only Batch Actor of the Connection On First Use */
+		if (!Batch.Channel.IsValid() && IsValid(Connection->PlayerController))
+		{
+			FActorSpawnParameters SpawnParameters;
+			SpawnParameters.Owner = Connection->PlayerController;
+			SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+			Batch.Channel = World->SpawnActor<AInteractionNotificationBatch>(SpawnParameters);
+		}
+
+		/* Hold the Batch Until the Actor Channel is Open so Notifications are Not Lost */
+		AInteractionNotificationBatch* Channel = Batch.Channel.Get();
+		if (Channel == nullptr || Connection->FindActorChannelRef(Channel) == nullptr)
+		{
+			/* Bound What a Connection That Can't be Served Holds, Keeping the Most Recent */
+			const int32 HeldCount = Batch.Pending.Num() + Batch.PendingObservers.Num();
+			if (HeldCount > MaxHeldNotifications)
+			{
+				UE_LOG(LogInteraction, Verbose, TEXT("Dropping %d Held Interaction Notifications of a Connection Without an Open Batch Channel"), HeldCount - MaxHeldNotifications);
+
+				/* Observer Notifications are Cosmetic, Drop them Before Owner Notifications */
+				const int32 NumObserversToDrop = FMath::Min(Batch.PendingObservers.Num(), HeldCount - MaxHeldNotifications);
+				Batch.PendingObservers.RemoveAt(0, NumObserversToDrop, false);
+
+				const int32 NumOwnerToDrop = FMath::Max(0, Batch.Pending.Num() - MaxHeldNotifications);
+				Batch.Pending.RemoveAt(0, NumOwnerToDrop, false);
+			}
+
+			continue;
+		}
+
+		if (Batch.Pending.Num() > 0)
+		{
+			Channel->Client_ReceiveNotifications(Batch.Pending);
+			Batch.Pending.Reset();
+
+			INC_DWORD_STAT(STAT_InteractionNotificationBatches);
+		}
+
+		/* Observer Batches are Unreliable, Keep Each One Small Enough to Never be Split Across Packets */
+		for (int32 Start = 0; Start < Batch.PendingObservers.Num(); Start += AInteractionNotificationBatch::MaxObserverNotifications)
+		{
+			const int32 Count = FMath::Min(AInteractionNotificationBatch::MaxObserverNotifications, Batch.PendingObservers.Num() - Start);
+
+			Channel->Client_ReceiveObserverNotifications(TArray<FInteractionNotification>(Batch.PendingObservers.GetData() + Start, Count));
+
+			INC_DWORD_STAT(STAT_InteractionNotificationBatches);
+		}
+
+		Batch.PendingObservers.Reset();
+	}
+}
+
+bool UInteractionSubsystem::AreFeedbackAssetsLoaded(const UInteractionComponent* InteractionComponent) const
+{
+	/* Weak Pointer Keys Can't be Built From a Const Pointer, the Lookup Does Not Modify the Component */
+	const TSharedPtr<FStreamableHandle>* PrefetchHandle = PrefetchHandles.Find(const_cast<UInteractionComponent*>(InteractionComponent));
+
+	return PrefetchHandle != nullptr && PrefetchHandle->IsValid() && (*PrefetchHandle)->HasLoadCompleted();
+}
+
+void UInteractionSubsystem::UpdateFeedbackPrefetch()
+{
+	UWorld* World = GetWorld();
+	if (!IsValid(World) || World->GetNetMode() == NM_DedicatedServer)
+	{
+		return;
+	}
+
+	/* Amortize the Distance Checks Over the Prefetch Interval */
+	const float CurrentTime = World->GetRealTimeSeconds();
+	if (CurrentTime - LastPrefetchTime < PrefetchInterval)
+	{
+		return;
+	}
+
+	LastPrefetchTime = CurrentTime;
+
+	SCOPE_CYCLE_COUNTER(STAT_InteractionFeedbackPrefetch);
+
+	const APlayerController* PlayerController = World->GetFirstPlayerController();
+	if (!IsValid(PlayerController) || !PlayerController->IsLocalController())
+	{
+		return;
+	}
+
+	FVector ViewLocation;
+	FRotator ViewRotation;
+	PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+
+	const float ReleaseRadiusSquared = FMath::Square(FMath::Max(PrefetchReleaseRadius, PrefetchRadius));
+
+	/* Release Assets of Interactions Beyond the Release Radius or Gone */
+	for (auto It = PrefetchHandles.CreateIterator(); It; ++It)
+	{
+		const UInteractionComponent* InteractionComponent = It.Key().Get();
+
+		if (InteractionComponent == nullptr || FVector::DistSquared(InteractionComponent->GetInteractionLocation(), ViewLocation) > ReleaseRadiusSquared)
+		{
+			if (It.Value().IsValid())
+			{
+				It.Value()->ReleaseHandle();
+			}
+
+			It.RemoveCurrent();
+		}
+	}
+
+	/* Prefetch Assets of Interactions Entering the Prefetch Radius */
+	TArray<FSoftObjectPath> AssetPaths;
+
+	ForEachInteractionInRadius(ViewLocation, PrefetchRadius, [this, &AssetPaths](UInteractionComponent* InteractionComponent)
+	{
+		if (!InteractionComponent->FeedbackAssets.HasAssets() || PrefetchHandles.Contains(InteractionComponent))
+		{
+			return;
+		}
+
+		AssetPaths.Reset();
+		InteractionComponent->FeedbackAssets.GetAssetPaths(AssetPaths);
+
+		PrefetchHandles.Add(InteractionComponent, UAssetManager::GetStreamableManager().RequestAsyncLoad(AssetPaths, FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority));
+	});
+
+	SET_DWORD_STAT(STAT_InteractionPrefetched, PrefetchHandles.Num());
+}
+
+void UInteractionSubsystem::RecordLatency(EInteractionLatencyStage Stage, UNetConnection* Connection, float LatencyMs)
+{
+	LatencyStages[Stage].AddSample(LatencyMs);
+
+	if (Connection == nullptr)
+	{
+		return;
+	}
+
+	FConnectionRequestState& State = FindOrAddConnectionState(Connection);
+
+	if (!State.Latency.IsValid())
+	{
+		State.Latency = MakeShared<FInteractionLatencyStages>();
+	}
+
+	(*State.Latency)[Stage].AddSample(LatencyMs);
+}
+
+void UInteractionSubsystem::UpdateLatencyTelemetry()
+{
+	const FInteractionLatencyHistogram& RoundTrip = LatencyStages[EInteractionLatencyStage::ILS_RoundTrip];
+	const FInteractionLatencyHistogram& Server = LatencyStages[EInteractionLatencyStage::ILS_Server];
+
+	SET_FLOAT_STAT(STAT_InteractionRoundTripP50, RoundTrip.GetPercentile(0.50f));
+	SET_FLOAT_STAT(STAT_InteractionRoundTripP95, RoundTrip.GetPercentile(0.95f));
+	SET_FLOAT_STAT(STAT_InteractionRoundTripP99, RoundTrip.GetPercentile(0.99f));
+	SET_FLOAT_STAT(STAT_InteractionServerP50, Server.GetPercentile(0.50f));
+	SET_FLOAT_STAT(STAT_InteractionServerP95, Server.GetPercentile(0.95f));
+	SET_FLOAT_STAT(STAT_InteractionServerP99, Server.GetPercentile(0.99f));
+
+	const UWorld* World = GetWorld();
+	if (LatencyDumpInterval <= 0.0f || !IsValid(World))
+	{
+		return;
+	}
+
+	const float CurrentTime = World->GetRealTimeSeconds();
+	if (CurrentTime - LastLatencyDumpTime >= LatencyDumpInterval)
+	{
+		LastLatencyDumpTime = CurrentTime;
+		DumpLatency(bLatencyDumpCsv);
+	}
+}
+
+void UInteractionSubsystem::LogLatency()
+{
+	auto LogStages = [](const FString& Scope, const FInteractionLatencyStages& Stages)
+	{
+		for (int32 StageIndex = 0; StageIndex < static_cast<int32>(EInteractionLatencyStage::ILS_Count); ++StageIndex)
+		{
+			const EInteractionLatencyStage Stage = static_cast<EInteractionLatencyStage>(StageIndex);
+			const FInteractionLatencyHistogram& Histogram = Stages[Stage];
+
+			UE_LOG(LogInteraction, Log, TEXT("%s %s: %u Samples, P50 %.1fms, P95 %.1fms, P99 %.1fms"), *Scope, FInteractionLatencyStages::GetStageName(Stage),
+				Histogram.GetSampleCount(), Histogram.GetPercentile(0.50f), Histogram.GetPercentile(0.95f), Histogram.GetPercentile(0.99f));
+		}
+	};
+
+	LogStages(TEXT("Server"), LatencyStages);
+
+	for (const TPair<TWeakObjectPtr<UNetConnection>, FConnectionRequestState>& ConnectionState : ConnectionRequestStates)
+	{
+		if (ConnectionState.Key.IsValid() && ConnectionState.Value.Latency.IsValid())
+		{
+			LogStages(ConnectionState.Key->LowLevelGetRemoteAddress(true), *ConnectionState.Value.Latency);
+		}
+	}
+}
+
+FString UInteractionSubsystem::DumpLatency(bool bCsv)
+{
+	auto WriteStages = [bCsv](FString& Output, const FString& Scope, const FInteractionLatencyStages& Stages)
+	{
+		for (int32 StageIndex = 0; StageIndex < static_cast<int32>(EInteractionLatencyStage::ILS_Count); ++StageIndex)
+		{
+			const EInteractionLatencyStage Stage = static_cast<EInteractionLatencyStage>(StageIndex);
+			const FInteractionLatencyHistogram& Histogram = Stages[Stage];
+
+			const float P50 = Histogram.GetPercentile(0.50f);
+			const float P95 = Histogram.GetPercentile(0.95f);
+			const float P99 = Histogram.GetPercentile(0.99f);
+
+			if (bCsv)
+			{
+				Output += FString::Printf(TEXT("%s,%s,%u,%.2f,%.2f,%.2f\n"), *Scope, FInteractionLatencyStages::GetStageName(Stage), Histogram.GetSampleCount(), P50, P95, P99);
+			}
+			else
+			{
+				Output += FString::Printf(TEXT("\t{\"scope\":\"%s\",\"stage\":\"%s\",\"samples\":%u,\"p50\":%.2f,\"p95\":%.2f,\"p99\":%.2f},\n"), *Scope, FInteractionLatencyStages::GetStageName(Stage), Histogram.GetSampleCount(), P50, P95, P99);
+			}
+		}
+	};
+
+	FString Output = bCsv ? TEXT("Scope,Stage,Samples,P50,P95,P99\n") : TEXT("[\n");
+
+	WriteStages(Output, TEXT("Server"), LatencyStages);
+
+	for (const TPair<TWeakObjectPtr<UNetConnection>, FConnectionRequestState>& ConnectionState : ConnectionRequestStates)
+	{
+		if (ConnectionState.Key.IsValid() && ConnectionState.Value.Latency.IsValid())
+		{
+			WriteStages(Output, ConnectionState.Key->LowLevelGetRemoteAddress(true), *ConnectionState.Value.Latency);
+		}
+	}
+
+	/* Close the JSON Array Without a Trailing Comma */
+	if (!bCsv)
+	{
+		Output.RemoveFromEnd(TEXT(",\n"));
+		Output += TEXT("\n]\n");
+	}
+
+	const FString FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Interaction"), bCsv ? TEXT("Latency.csv") : TEXT("Latency.json"));
+
+	if (!FFileHelper::SaveStringToFile(Output, *FilePath))
+	{
+		UE_LOG(LogInteraction, Warning, TEXT("Unable to Write Interaction Latency Dump %s"), *FilePath);
+	}
+
+	return FilePath;
+}
+
+void UInteractionSubsystem::ResetLatency()
+{
+	LatencyStages.Reset();
+
+	for (TPair<TWeakObjectPtr<UNetConnection>, FConnectionRequestState>& ConnectionState : ConnectionRequestStates)
+	{
+		ConnectionState.Value.Latency.Reset();
+	}
+}
+
+void UInteractionSubsystem::RegisterServerInteractor(UInteractorComponent* InteractorComponent)
+{
+	if (IsValid(InteractorComponent))
+	{
+		ServerInteractors.AddUnique(InteractorComponent);
+	}
+}
+
+void UInteractionSubsystem::UnregisterServerInteractor(UInteractorComponent* InteractorComponent)
+{
+	ServerInteractors.RemoveSwap(InteractorComponent);
+}
+
+void UInteractionSubsystem::UpdateServerInteractors()
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionParallelServerUpdate);
+
+	/* Gather Interactors With an Interaction In Progress */
+	ActiveServerInteractors.Reset();
+
+	for (UInteractorComponent* InteractorComponent : ServerInteractors)
+	{
+		if (IsValid(InteractorComponent) && InteractorComponent->NeedsInteractionValidation())
+		{
+			ActiveServerInteractors.Add(InteractorComponent);
+		}
+	}
+
+	const int32 NumActive = ActiveServerInteractors.Num();
+	SET_DWORD_STAT(STAT_InteractionParallelValidated, NumActive);
+
+	if (NumActive == 0)
+	{
+		return;
+	}
+
+	ServerInteractorResults.SetNumUninitialized(NumActive);
+
+	/* Trace and Validate on Worker Threads, Each Interactor Only Writes its Own State and Output Slot */
+	ParallelFor(NumActive, [this](int32 Index)
+	{
+		ServerInteractorResults[Index] = ActiveServerInteractors[Index]->ValidateInteractionInProgress();
+	}, NumActive < MinParallelInteractors);
+
+	/* Apply State Transitions Serially on the Game Thread */
+	for (int32 Index = 0; Index < NumActive; ++Index)
+	{
+		UInteractorComponent* InteractorComponent = ActiveServerInteractors[Index];
+
+		if (IsValid(InteractorComponent))
+		{
+			InteractorComponent->ApplyInteractionValidation(ServerInteractorResults[Index]);
+		}
+	}
+}
+
+void UInteractionSubsystem::RegisterInteraction(UInteractionComponent* InteractionComponent)
+{
+	if (!IsValid(InteractionComponent) || RegistryIndices.Contains(InteractionComponent))
+	{
+		return;
+	}
+
+	/* Restore the Persistent State Immediately so a Streamed In Interaction Never Shows Stale State */
+	const AActor* Owner = InteractionComponent->GetOwner();
+	if (RecordLevels.Num() > 0 && IsValid(Owner) && Owner->HasAuthority() &&
+		RecordLevels.Contains(InteractionComponent->GetOutermost()->GetFName()))
+	{
+		FInteractionRecord Record;
+		if (RemoveInteractionRecord(InteractionComponent->GetPersistentId(), Record))
+		{
+			InteractionComponent->ReadInteractionRecord(Record);
+		}
+	}
+
+	/* Restored Sessions Waiting For this Interaction Resume on the Next Tick */
+	if (PendingResumeInteractions.Num() > 0)
+	{
+		AddPendingResumeInteraction(InteractionComponent);
+	}
+
+	/* Indexed Right Away so Tag Queries Never Miss Interactions Pending Registration */
+	if (!InteractionComponent->InteractionTags.IsEmpty())
+	{
+		TagIndex.SetCellSize(TagIndexCellSize);
+		TagIndex.Add(InteractionComponent);
+		SET_DWORD_STAT(STAT_InteractionTagIndexed, TagIndex.Num());
+	}
+
+	/* Constant Time, Streaming In Hundreds of Interactions Adds No Per Interaction Work Beyond this */
+	RegistryIndices.Add(InteractionComponent, RegisteredInteractions.Add(InteractionComponent));
+	INC_DWORD_STAT(STAT_InteractionRegistered);
+}
+
+void UInteractionSubsystem::UnregisterInteraction(UInteractionComponent* InteractionComponent, bool bStoreRecord /* = false */)
+{
+	if (!IsValid(InteractionComponent))
+	{
+		return;
+	}
+
+	TagIndex.Remove(InteractionComponent);
+	SET_DWORD_STAT(STAT_InteractionTagIndexed, TagIndex.Num());
+
+	int32 RegistryIndex = INDEX_NONE;
+	if (RegistryIndices.RemoveAndCopyValue(InteractionComponent, RegistryIndex))
+	{
+		RegisteredInteractions.RemoveAtSwap(RegistryIndex);
+
+		/* Fix Up the Index of the Interaction Swapped Into the Removed Slot */
+		if (RegisteredInteractions.IsValidIndex(RegistryIndex))
+		{
+			RegistryIndices.Add(RegisteredInteractions[RegistryIndex], RegistryIndex);
+		}
+
+		DEC_DWORD_STAT(STAT_InteractionRegistered);
+	}
+
+	/* Release Prefetched Feedback Assets */
+	TSharedPtr<FStreamableHandle> PrefetchHandle;
+	if (PrefetchHandles.RemoveAndCopyValue(InteractionComponent, PrefetchHandle) && PrefetchHandle.IsValid())
+	{
+		PrefetchHandle->ReleaseHandle();
+	}
+
+	/* Keep a Compact Record of Interactions Whose Level is Streamed Out */
+	const AActor* Owner = InteractionComponent->GetOwner();
+	if (bStoreRecord && IsValid(Owner) && Owner->HasAuthority())
+	{
+		const FName PersistentId = InteractionComponent->GetPersistentId();
+
+		if (!PersistentId.IsNone())
+		{
+			InteractionComponent->WriteInteractionRecord(FindOrAddInteractionRecord(PersistentId));
+		}
+	}
+}
+
+FInteractionRecord& UInteractionSubsystem::FindOrAddInteractionRecord(FName PersistentId)
+{
+	if (FInteractionRecord* Record = InteractionRecords.Find(PersistentId))
+	{
+		return *Record;
+	}
+
+	INC_DWORD_STAT(STAT_InteractionRecords);
+	++RecordLevels.FindOrAdd(GetRecordLevel(PersistentId));
+
+	return InteractionRecords.Add(PersistentId);
+}
+
+bool UInteractionSubsystem::RemoveInteractionRecord(FName PersistentId, FInteractionRecord& OutRecord)
+{
+	if (PersistentId.IsNone() || !InteractionRecords.RemoveAndCopyValue(PersistentId, OutRecord))
+	{
+		return false;
+	}
+
+	DEC_DWORD_STAT(STAT_InteractionRecords);
+
+	const FName RecordLevel = GetRecordLevel(PersistentId);
+	int32* NumLevelRecords = RecordLevels.Find(RecordLevel);
+	if (NumLevelRecords != nullptr && --(*NumLevelRecords) <= 0)
+	{
+		RecordLevels.Remove(RecordLevel);
+	}
+
+	return true;
+}
+
+FName UInteractionSubsystem::GetRecordLevel(FName PersistentId)
+{
+	return FName(*FPackageName::ObjectPathToPackageName(PersistentId.ToString()));
+}
+
+void UInteractionSubsystem::QueryInteractions(FVector Center, float Radius, const FGameplayTagContainer& RequiredTags, const FGameplayTagContainer& BlockedTags, TArray<UInteractionComponent*>& OutInteractions) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionTagQuery);
+
+	OutInteractions.Reset();
+	TagIndex.Query(Center, Radius, RequiredTags, BlockedTags, OutInteractions);
+}
+
+void UInteractionSubsystem::QueryInteractionItems(FVector Center, float Radius, const FGameplayTagContainer& RequiredTags, const FGameplayTagContainer& BlockedTags, TArray<UInteractionComponent*>& OutInteractions, TArray<int32>& OutItems) const
+{
+	SCOPE_CYCLE_COUNTER(STAT_InteractionTagQuery);
+
+	OutInteractions.Reset();
+	OutItems.Reset();
+	TagIndex.Query(Center, Radius, RequiredTags, BlockedTags, OutInteractions, &OutItems);
+}
+
+void UInteractionSubsystem::UpdateInteractionTags(UInteractionComponent* InteractionComponent)
+{
+	if (!IsValid(InteractionComponent))
+	{
+		return;
+	}
+
+	/* Unregistered Interactions, E.g Pooled, are Indexed Again When they Register */
+	if (RegistryIndices.Contains(InteractionComponent))
+	{
+		TagIndex.SetCellSize(TagIndexCellSize);
+		TagIndex.Add(InteractionComponent);
+		SET_DWORD_STAT(STAT_InteractionTagIndexed, TagIndex.Num());
+	}
+}
+
+void UInteractionSubsystem::UpdateInteractionLocation(UInteractionComponent* InteractionComponent)
+{
+	/* Only Indexed Interactions Have Locations to Update */
+	if (IsValid(InteractionComponent))
+	{
+		TagIndex.Move(InteractionComponent);
+		SET_DWORD_STAT(STAT_InteractionTagIndexed, TagIndex.Num());
+	}
+}
+
+void UInteractionSubsystem::ForEachInteractionInRadius(const FVector& Center, float Radius, TFunctionRef<void(UInteractionComponent*)> Callback) const
+{
+	const float RadiusSquared = FMath::Square(Radius);
+
+	for (UInteractionComponent* InteractionComponent : RegisteredInteractions)
+	{
+		if (IsValid(InteractionComponent) && FVector::DistSquared(InteractionComponent->GetInteractionLocation(), Center) <= RadiusSquared)
+		{
+			Callback(InteractionComponent);
+		}
+	}
+}
+
+bool UInteractionSubsystem::ConsumeConnectionRequest(UNetConnection* Connection)
+{
+	/* Requests Without a Connection Are Local and Never Limited */
+	if (Connection == nullptr)
+	{
+		return true;
+	}
+
+	const UWorld* World = GetWorld();
+	const float CurrentTime = IsValid(World) ? World->GetRealTimeSeconds() : 0.0f;
+
+	return FindOrAddConnectionState(Connection).Bucket.TryConsume(CurrentTime, ConnectionRequestRate, ConnectionRequestBurst);
+}
+
+void UInteractionSubsystem::RecordServerRequest(UNetConnection* Connection, bool bAccepted)
+{
+	if (bAccepted)
+	{
+		++AcceptedRequestCount;
+		INC_DWORD_STAT(STAT_InteractionServerRequestsAccepted);
+		return;
+	}
+
+	++DroppedRequestCount;
+	INC_DWORD_STAT(STAT_InteractionServerRequestsDropped);
+
+	if (Connection == nullptr)
+	{
+		return;
+	}
+
+	/* Throttle Warnings to Once per Second per Connection */
+	const UWorld* World = GetWorld();
+	const float CurrentTime = IsValid(World) ? World->GetRealTimeSeconds() : 0.0f;
+
+	FConnectionRequestState& State = FindOrAddConnectionState(Connection);
+	++State.DroppedSinceLog;
+
+	if (CurrentTime - State.LastLogTime >= 1.0f)
+	{
+		UE_LOG(LogInteraction, Warning, TEXT("Dropped %d Rate Limited Interaction Requests From %s"), State.DroppedSinceLog, *Connection->LowLevelGetRemoteAddress(true));
+
+		State.DroppedSinceLog = 0;
+		State.LastLogTime = CurrentTime;
+	}
+}
+
+UInteractionSubsystem::FConnectionRequestState& UInteractionSubsystem::FindOrAddConnectionState(UNetConnection* Connection)
+{
+	if (FConnectionRequestState* State = ConnectionRequestStates.Find(Connection))
+	{
+		return *State;
+	}
+
+	/* Prune Closed Connections Before Adding a New One */
+	for (auto It = ConnectionRequestStates.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().IsValid())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	return ConnectionRequestStates.Add(Connection);
+}
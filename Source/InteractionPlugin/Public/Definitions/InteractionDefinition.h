@@ -0,0 +1,77 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "InteractionDataTypes.h"
+#include "InteractionDefinition.generated.h"
+
+/**
+ * Shared Immutable Interaction Configuration Referenced by Many Interaction Components
+ *
+ * Components Read their Config From the Definition Unless the Matching Override Flag Is Set on the Component,
+ * so Retuning a Definition Applies to Every Placed Interactable Without Resaving Levels.
+ */
+UCLASS(BlueprintType)
+class INTERACTIONPLUGIN_API UInteractionDefinition : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+
+	UInteractionDefinition();
+
+	/**
+	 * Primary Asset Type of Interaction Definitions
+	 */
+	static const FPrimaryAssetType PrimaryAssetType;
+
+	/**
+	 * Returns the Primary Asset Id Used by the Asset Manager
+	 */
+	FPrimaryAssetId GetPrimaryAssetId() const override;
+
+	/**
+	 * [Config] Configuration to Determine Interaction State Over Net
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction", meta = (DisplayName = "State Net Mode"))
+		EInteractionNetMode InteractionStateNetMode;
+
+	/**
+	 * [Config] Boolean to Allow Multiple Interaction at Once
+	 * @note Does Not Apply to Instant Interaction
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction", meta = (DisplayName = "Allow Multiple Interaction"))
+		bool bMultipleInteraction;
+
+	/**
+	 * [Config] Boolean to Allow Interaction Only If Interactor Is Looking at the Face/Front of the Object
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction")
+		bool bOnlyFaceInteraction;
+
+	/**
+	 * [Config] Duration Required for a Hold Interaction to be Completed
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction|Hold", meta = (ClampMin = 0.0f))
+		float InteractionDuration;
+
+	/**
+	 * [Config] Boolean to Queue Interactors Rejected Due to a Hold Interaction Already In Progress
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction|Queue")
+		bool bQueueInteractors;
+
+	/**
+	 * [Config] Maximum Number of Interactors Waiting in the Queue
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction|Queue", meta = (ClampMin = 1, EditCondition = "bQueueInteractors"))
+		int32 MaxQueuedInteractors;
+
+	/**
+	 * [Config] Order in Which Queued Interactors are Promoted
+	 */
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Interaction|Queue", meta = (EditCondition = "bQueueInteractors"))
+		EInteractionQueueOrder QueueOrder;
+};
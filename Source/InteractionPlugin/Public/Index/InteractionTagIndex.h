@@ -0,0 +1,202 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class UInteractionComponent;
+
+/**
+ * Gameplay Tags Compiled to Bits, Tested Four Words at a Time With Vector Instructions
+ */
+struct FInteractionTagMask
+{
+	/** Maximum Number of Distinct Tags Compiled per World */
+	static constexpr int32 MaxBits = 128;
+
+	uint32 Words[4];
+
+	FInteractionTagMask()
+	{
+		FMemory::Memzero(Words);
+	}
+
+	FORCEINLINE void SetBit(int32 Bit)
+	{
+		Words[Bit >> 5] |= 1u << (Bit & 31);
+	}
+
+	FORCEINLINE FInteractionTagMask& operator|=(const FInteractionTagMask& Other)
+	{
+		Words[0] |= Other.Words[0];
+		Words[1] |= Other.Words[1];
+		Words[2] |= Other.Words[2];
+		Words[3] |= Other.Words[3];
+		return *this;
+	}
+};
+
+/**
+ * Spatial Index of Tagged Interactions for Filtered Radius Queries
+ *
+ * Each Grid Cell Keeps the Tag Masks, Locations and Components of its Interactions in Contiguous Arrays Plus the Union of its Masks,
+ * so Cells Without a Possible Match are Skipped Whole and the Others are Filtered With Bitwise Vector Tests Before Any Distance Check.
+ * Tags Include their Parents, a Query For Loot Matches Loot.Chest.
+ * Interactions With Items, E.g Instanced Interactions, Have an Entry per Item at the Item Location.
+ * @note Locations are Captured When an Interaction is Added, Moved Interactions Call Move to Update them
+ */
+class INTERACTIONPLUGIN_API FInteractionTagIndex
+{
+public:
+
+	FInteractionTagIndex()
+		:CellSize(2000.0f)
+		,NumInteractions(0)
+		,bTagBitsExhausted(false)
+	{}
+
+	/**
+	 * Sets the Size of the Grid Cells, Ignored Unless the Index is Empty
+	 */
+	void SetCellSize(float NewCellSize);
+
+	/**
+	 * Adds an Interaction or Updates its Tags and Location, Interactions Without Tags are Removed
+	 */
+	void Add(UInteractionComponent* InteractionComponent);
+
+	/**
+	 * Updates the Locations of an Indexed Interaction, Entries Staying in their Cell are Updated In Place
+	 */
+	void Move(UInteractionComponent* InteractionComponent);
+
+	/**
+	 * Removes an Interaction and All its Items
+	 */
+	void Remove(const UInteractionComponent* InteractionComponent);
+
+	/**
+	 * Gathers the Interactions Within a Radius Having All the Required Tags and None of the Blocked Tags
+	 *
+	 * @param Center - World Location
+	 * @param Radius - Radius of the Query
+	 * @param RequiredTags - Tags Every Result Has
+	 * @param BlockedTags - Tags No Result Has
+	 * @param OutInteractions - Matching Interactions, Appended Once Unless Items are Gathered
+	 * @param OutItems - Optional Matching Item of Each Appended Interaction, Each Matching Item is Appended With its Interaction
+	 */
+	void Query(const FVector& Center, float Radius, const FGameplayTagContainer& RequiredTags, const FGameplayTagContainer& BlockedTags, TArray<UInteractionComponent*>& OutInteractions, TArray<int32>* OutItems = nullptr) const;
+
+	/**
+	 * Returns the Number of Indexed Entries, One per Item of Interactions With Items
+	 */
+	FORCEINLINE int32 Num() const
+	{
+		return NumInteractions;
+	}
+
+	/**
+	 * Removes Every Interaction and Compiled Tag
+	 */
+	void Reset();
+
+private:
+
+	/**
+	 * Interactions of a Grid Cell in Contiguous Arrays
+	 */
+	struct FCell
+	{
+		TArray<FInteractionTagMask> Masks;
+
+		TArray<FVector> Locations;
+
+		TArray<UInteractionComponent*> Components;
+
+		/** Item of Each Entry, INDEX_NONE For Interactions Without Items */
+		TArray<int32> Items;
+
+		/** Union of the Masks of the Cell */
+		FInteractionTagMask Union;
+	};
+
+	/**
+	 * Position of an Interaction Entry in the Index
+	 */
+	struct FSlot
+	{
+		FIntPoint Cell;
+
+		int32 Index;
+	};
+
+	/**
+	 * Appends an Entry to the Cell Containing its Location
+	 */
+	FSlot AddEntry(UInteractionComponent* InteractionComponent, int32 Item, const FInteractionTagMask& Mask, const FVector& Location);
+
+	/**
+	 * Removes an Entry, Fixing Up the Slot of the Entry Swapped Into its Place
+	 * @note Leaves the Union of the Cell Stale, Call RecomputeUnions Once All Entries of an Interaction are Removed
+	 */
+	void RemoveEntry(const FSlot& Slot);
+
+	/**
+	 * Rebuilds the Union of Cells Entries Were Removed From, Cells Emptied Meanwhile are Skipped
+	 */
+	void RecomputeUnions(const TSet<FIntPoint>& TouchedCells);
+
+	/**
+	 * Returns the Slot Index of an Item, Items are Stored in Order and Interactions Without Items Have a Single Slot
+	 */
+	static FORCEINLINE int32 GetSlotIndex(int32 Item)
+	{
+		return Item == INDEX_NONE ? 0 : Item;
+	}
+
+	/**
+	 * Compiles the Tags of an Interaction and their Parents, Assigning Bits to New Tags
+	 */
+	FInteractionTagMask CompileInteractionTags(const FGameplayTagContainer& Tags);
+
+	/**
+	 * Compiles the Tags of a Query Without Assigning Bits
+	 *
+	 * @param bOutExact - Set If a Tag Has No Bit Because Bits Ran Out, Results Must be Verified Against the Component Tags
+	 * @returns False If a Tag Has No Bit
+	 */
+	bool CompileQueryTags(const FGameplayTagContainer& Tags, FInteractionTagMask& OutMask, bool& bOutExact) const;
+
+	/**
+	 * Appends the Matching Entries of a Cell
+	 */
+	void QueryCell(const FCell& Cell, const FVector& Center, float RadiusSquared, const FInteractionTagMask& RequiredMask, const FInteractionTagMask& BlockedMask,
+		const FGameplayTagContainer* ExactRequiredTags, const FGameplayTagContainer* ExactBlockedTags, TArray<UInteractionComponent*>& OutInteractions, TArray<int32>& OutItems) const;
+
+	/**
+	 * Returns the Grid Cell Containing a Location
+	 */
+	FORCEINLINE FIntPoint GetCell(const FVector& Location) const
+	{
+		return FIntPoint(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+	}
+
+	/** Bit of Each Compiled Tag */
+	TMap<FGameplayTag, int32> TagBits;
+
+	/** Non Empty Grid Cells */
+	TMap<FIntPoint, FCell> Cells;
+
+	/** Position of the Entries of Each Indexed Interaction, Indexed by Item */
+	TMap<const UInteractionComponent*, TArray<FSlot>> Slots;
+
+	/** Size of the Grid Cells */
+	float CellSize;
+
+	/** Number of Indexed Entries */
+	int32 NumInteractions;
+
+	/** Whether Tags Were Left Without a Bit */
+	bool bTagBitsExhausted;
+};
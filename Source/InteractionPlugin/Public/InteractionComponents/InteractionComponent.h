@@ -4,9 +4,14 @@
 
 #include "CoreMinimal.h"
 #include "Components/SceneComponent.h"
+#include "GameplayTagContainer.h"
 #include "InteractionDataTypes.h"
+#include "InteractionSession.h"
+#include "Definitions/InteractionDefinition.h"
 #include "InteractionComponent.generated.h"
 
+struct FInteractionRecord;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInteractionStateChanged, EInteractionResult, InteractionResult, AActor*, InteractionActor);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractionFocusChanged, bool, bInFocus);
 
@@ -14,6 +19,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractionFocusChanged, bool, bI
 DECLARE_LOG_CATEGORY_EXTERN(LogInteraction, Log, All);
 
 class UInteractorComponent;
+class UShapeComponent;
 
 UCLASS( ClassGroup=(Custom), Abstract)
 class INTERACTIONPLUGIN_API UInteractionComponent : public USceneComponent
@@ -25,11 +31,37 @@ public:
 	// Sets default values for this component's properties
 	UInteractionComponent();
 
+	/**
+	 * Returns the properties used for network replication
+	 */
+	virtual void GetLifetimeReplicatedProps(TArray< FLifetimeProperty > & OutLifetimeProps) const override;
+
 	/**
 	 * Ends Gameplay For this Component. Allows the Interaction to begin Asynchronous Cleanup
 	 */
 	void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
+	/**
+	 * Registers the Interaction With the Interaction Subsystem
+	 */
+	void BeginPlay() override;
+
+	/**
+	 * Resolves the Anchor and Detaches Anchored Components to Skip Transform Propagation
+	 * Creates the Proxy Shape If Any
+	 */
+	void OnRegister() override;
+
+	/**
+	 * Destroys the Proxy Shape
+	 */
+	void OnUnregister() override;
+
+	/**
+	 * Updates the Location of the Interaction in the Tag Index
+	 */
+	void OnUpdateTransform(EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport = ETeleportType::None) override;
+
 	/* Delegate to Notify Interactor Focus Changed */
 	UPROPERTY(BlueprintAssignable)
 		FOnInteractionFocusChanged OnInteractionFocusChanged;
@@ -40,6 +72,26 @@ public:
 	UPROPERTY(BlueprintAssignable)
 		FOnInteractionStateChanged OnInteractionStateChanged;
 
+	/**
+	 * [Config] Shared Interaction Definition Providing the Config of this Component
+	 * @note Config Values Below are Only Used If No Definition is Set or their Override Flag is Enabled,
+	 *		 Blueprint Writes Go Through the Setters Which Enable the Override Flag
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "InteractionComponent|Config")
+		UInteractionDefinition* Definition;
+
+	/** [Config] Override the State Net Mode of the Definition */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "InteractionComponent|Overrides")
+		uint8 bOverride_InteractionStateNetMode : 1;
+
+	/** [Config] Override the Allow Multiple Interaction of the Definition */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "InteractionComponent|Overrides")
+		uint8 bOverride_bMultipleInteraction : 1;
+
+	/** [Config] Override the Only Face Interaction of the Definition */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "InteractionComponent|Overrides")
+		uint8 bOverride_bOnlyFaceInteraction : 1;
+
 	/**
 	 * [Config] Configuration to Determine Interaction State Over Net
 	 *
@@ -47,23 +99,217 @@ public:
 	 * OwnerOnly : Only the Local Owner of the Interaction Component Will Receive the Update
 	 * All		 : All Clients With this Instance of the Interaction Component Will Receive the Update
 	 */
-	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "InteractionComponent|Config", meta = (DisplayName = "State Net Mode"))
+	UPROPERTY(EditAnywhere, BlueprintGetter = GetStateNetMode, BlueprintSetter = SetStateNetMode, Category = "InteractionComponent|Config", meta = (DisplayName = "State Net Mode", EditCondition = "bOverride_InteractionStateNetMode || Definition == nullptr"))
 		EInteractionNetMode InteractionStateNetMode;
 
 	/**
 	 * [Config] Boolean to Allow Multiple Interaction at Once
 	 * @note Does Not Apply to Instant Interaction
 	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "InteractionComponent|Config", meta = (DisplayName = "Allow Multiple Interaction"))
+	UPROPERTY(EditAnywhere, BlueprintGetter = AllowsMultipleInteraction, BlueprintSetter = SetAllowsMultipleInteraction, Category = "InteractionComponent|Config", meta = (DisplayName = "Allow Multiple Interaction", EditCondition = "bOverride_bMultipleInteraction || Definition == nullptr"))
 		bool bMultipleInteraction;
 
 	/**
 	 * [Config] Boolean to Allow Interaction Only If Interactor Is Looking at the Face/Fron of the Object
 	 * @note Set to True If Interactor can Only Interact From the front of this Object
 	 */
-	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "InteractionComponent|Config")
+	UPROPERTY(EditAnywhere, BlueprintGetter = RequiresFaceInteraction, BlueprintSetter = SetRequiresFaceInteraction, Category = "InteractionComponent|Config", meta = (EditCondition = "bOverride_bOnlyFaceInteraction || Definition == nullptr"))
 		bool bOnlyFaceInteraction;
 
+	/**
+	 * [Config] Boolean to Compute the Interaction Location and Forward On Demand From an Anchor Instead of this Component's Transform
+	 * @note Anchored Components are Detached at Runtime and No Longer Pay for Attachment and Transform Propagation
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "InteractionComponent|Anchor")
+		bool bUseAnchor;
+
+	/**
+	 * [Config] Name of the Owner Scene Component to Anchor To, Owner Root Component If None or Not Found
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "InteractionComponent|Anchor", meta = (EditCondition = "bUseAnchor"))
+		FName AnchorComponentName;
+
+	/**
+	 * [Config] Socket on the Anchor Component, Anchor Component Transform If None
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "InteractionComponent|Anchor", meta = (EditCondition = "bUseAnchor"))
+		FName AnchorSocketName;
+
+	/**
+	 * [Config] Local Offset From the Anchor Socket
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "InteractionComponent|Anchor", meta = (EditCondition = "bUseAnchor"))
+		FVector AnchorOffset;
+
+	/**
+	 * [Config] Prompt and Feedback Assets, Prefetched Asynchronously Near the Local Interactor
+	 * @see UInteractionSubsystem::bPrefetchFeedbackAssets
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "InteractionComponent|Feedback")
+		FInteractionFeedbackAssets FeedbackAssets;
+
+	/**
+	 * [Config] Actors Whose Interaction Components are Driven by this Interaction
+	 * @note Results of this Interaction are Fanned Out to Each Member's OnInteractionStateChanged From a Single Group Notification
+	 *		 Members Not Yet Relevant to a Client Receive the Last Result Once they Resolve
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, ReplicatedUsing = OnRep_GroupMemberActors, Category = "InteractionComponent|Group")
+		TArray<AActor*> GroupMemberActors;
+
+	/**
+	 * Sets the Group Members Driven by this Interaction
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = InteractionComponent)
+		void SetGroupMemberActors(const TArray<AActor*>& NewGroupMemberActors);
+
+	/**
+	 * [Config] Gameplay Tags Describing this Interaction, E.g Lootable or Locked
+	 * @note Indexed by the Interaction Subsystem for Filtered Radius Queries, @see UInteractionSubsystem::QueryInteractions
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, ReplicatedUsing = OnRep_InteractionTags, Category = "InteractionComponent|Tags")
+		FGameplayTagContainer InteractionTags;
+
+	/**
+	 * Sets the Gameplay Tags of this Interaction and Updates the Tag Index
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = InteractionComponent)
+		void SetInteractionTags(const FGameplayTagContainer& NewInteractionTags);
+
+	/**
+	 * Updates the Tag Index of the Interaction Subsystem With the Current Tags and Location
+	 * @note Moving the Interaction or its Anchor Updates the Index Location Automatically
+	 */
+	UFUNCTION(BlueprintCallable, Category = InteractionComponent)
+		void UpdateInteractionIndex();
+
+	/**
+	 * [Config] Simple Shape Generated to Receive Interaction Traces Instead of the Owner Scene Collision
+	 *
+	 * None				: No Proxy, the Owner Collision Must Block the Interaction Trace Channel
+	 * Sphere/Box/Capsule	: A Shape Component is Generated per Interaction
+	 * Owner Primitive	: No Component is Generated, the Anchor or Root Primitive Blocks the Interaction Trace Channel
+	 *
+	 * @note Proxies Only Block the Interaction Trace Channel, @see UInteractionSubsystem::InteractionTraceChannel
+	 * @note Proxies are Skipped While the Channel is Visibility Unless UInteractionSubsystem::bProxiesBlockVisibility is Set
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "InteractionComponent|Proxy")
+		EInteractionProxyShape ProxyShape;
+
+	/**
+	 * [Config] Size of the Proxy Shape
+	 *
+	 * Sphere	: X is the Radius
+	 * Box		: Box Extent
+	 * Capsule	: X is the Radius, Z is the Half Height
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "InteractionComponent|Proxy", meta = (EditCondition = "ProxyShape != EInteractionProxyShape::IPS_None && ProxyShape != EInteractionProxyShape::IPS_Owner"))
+		FVector ProxyExtent;
+
+	/**
+	 * Returns the Generated Proxy Shape, Null If None
+	 */
+	UFUNCTION(BlueprintPure, Category = InteractionComponent)
+		FORCEINLINE UShapeComponent* GetProxyComponent() const
+	{
+		return ProxyComponent;
+	}
+
+	/**
+	 * Returns the World Location Used for Interaction Direction Validation
+	 *
+	 * @param Item - Interaction Item Index, @see ResolveInteractionItem
+	 */
+	UFUNCTION(BlueprintPure, Category = InteractionComponent)
+		virtual FVector GetInteractionLocation(int32 Item = -1) const;
+
+	/**
+	 * Returns the World Forward Vector Used for Interaction Direction Validation
+	 *
+	 * @param Item - Interaction Item Index, @see ResolveInteractionItem
+	 */
+	UFUNCTION(BlueprintPure, Category = InteractionComponent)
+		virtual FVector GetInteractionForwardVector(int32 Item = -1) const;
+
+	/**
+	 * Resolves the Interaction Item Hit by an Interactor Trace
+	 * Items Allow a Single Component to Handle Many Interactables, E.g Instances of an Instanced Static Mesh
+	 *
+	 * @param Hit - Interactor Trace Hit Result
+	 * @param OutItem - Out Item Index or INDEX_NONE If the Component is a Single Interactable
+	 * @returns False If the Hit Does Not Belong to Any Item of this Interaction
+	 */
+	virtual bool ResolveInteractionItem(const FHitResult& Hit, int32& OutItem) const
+	{
+		OutItem = INDEX_NONE;
+		return true;
+	}
+
+	/**
+	 * Returns the Number of Interaction Items, Zero If the Component is a Single Interactable
+	 * @note Items are Indexed Separately at their Own Locations
+	 */
+	virtual int32 GetNumInteractionItems() const
+	{
+		return 0;
+	}
+
+	/**
+	 * Returns the Effective State Net Mode From the Definition or the Override
+	 */
+	UFUNCTION(BlueprintGetter, Category = InteractionComponent)
+		FORCEINLINE EInteractionNetMode GetStateNetMode() const
+	{
+		return Definition != nullptr && !bOverride_InteractionStateNetMode ? Definition->InteractionStateNetMode : InteractionStateNetMode;
+	}
+
+	/**
+	 * Setter for the State Net Mode, Overrides the Definition
+	 */
+	UFUNCTION(BlueprintSetter, Category = InteractionComponent)
+		void SetStateNetMode(const EInteractionNetMode NewStateNetMode)
+	{
+		InteractionStateNetMode = NewStateNetMode;
+		bOverride_InteractionStateNetMode = true;
+	}
+
+	/**
+	 * Returns Whether Multiple Interaction is Allowed From the Definition or the Override
+	 */
+	UFUNCTION(BlueprintGetter, Category = InteractionComponent)
+		FORCEINLINE bool AllowsMultipleInteraction() const
+	{
+		return Definition != nullptr && !bOverride_bMultipleInteraction ? Definition->bMultipleInteraction : bMultipleInteraction;
+	}
+
+	/**
+	 * Setter for Allow Multiple Interaction, Overrides the Definition
+	 */
+	UFUNCTION(BlueprintSetter, Category = InteractionComponent)
+		void SetAllowsMultipleInteraction(const bool bNewMultipleInteraction)
+	{
+		bMultipleInteraction = bNewMultipleInteraction;
+		bOverride_bMultipleInteraction = true;
+	}
+
+	/**
+	 * Returns Whether Only Face Interaction is Required From the Definition or the Override
+	 */
+	UFUNCTION(BlueprintGetter, Category = InteractionComponent)
+		FORCEINLINE bool RequiresFaceInteraction() const
+	{
+		return Definition != nullptr && !bOverride_bOnlyFaceInteraction ? Definition->bOnlyFaceInteraction : bOnlyFaceInteraction;
+	}
+
+	/**
+	 * Setter for Only Face Interaction, Overrides the Definition
+	 */
+	UFUNCTION(BlueprintSetter, Category = InteractionComponent)
+		void SetRequiresFaceInteraction(const bool bNewOnlyFaceInteraction)
+	{
+		bOnlyFaceInteraction = bNewOnlyFaceInteraction;
+		bOverride_bOnlyFaceInteraction = true;
+	}
+
 
 
 	/**
@@ -91,6 +337,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = InteractionComponent)
 		virtual bool CanInteractWith(UInteractorComponent* InteractorComp);
 
+	/**
+	 * Tries to Queue an Interactor that Was Rejected Due to an Interaction Already In Progress
+	 *
+	 * @param InteractorComp - Interactor Component Trying to Interact
+	 * @returns True If the Interactor Was Queued and Will be Promoted Later
+	 */
+	UFUNCTION(BlueprintCallable, Category = InteractionComponent)
+		virtual bool TryQueueInteraction(UInteractorComponent* InteractorComp);
+
 	/**
 	 * Invoked By Interactor to Notify Interaction is Under Focus
 	 */
@@ -107,6 +362,86 @@ public:
 	UFUNCTION()
 		void ClientNotifyInteraction(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent);
 
+	/**
+	 * Handles a Notification Received in a Batch, @see AInteractionNotificationBatch
+	 *
+	 * @param bGroup - Whether it Was Sent as the Group Notification
+	 */
+	void ReceiveNotification(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent, bool bGroup);
+
+	/**
+	 * Handles the Interaction State Forwarded by the Reliable Owner Notification of the Interactor
+	 *
+	 * @param InteractionResult - Result of the Interaction
+	 * @param NewInteractionComponent - Interactor Forwarding the Notification
+	 */
+	void ReceiveOwnerNotification(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent);
+
+	/**
+	 * Accepts an Observer Notification Unless it is Stale or the Interactor Owner Receives it Reliably
+	 *
+	 * @param Sequence - Observer Sequence of the Notification
+	 * @param NewInteractionComponent - Interactor of the Interaction
+	 */
+	bool AcceptObserverNotification(uint8 Sequence, const UInteractorComponent* NewInteractionComponent);
+
+	/**
+	 * Interrupts Every Interaction In Progress Through CompleteInteraction
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = InteractionComponent)
+		virtual void InterruptAllInteractions() {}
+
+	/**
+	 * [Overridden] Interrupts Interactions In Progress and Releases the Focus Before Deactivating
+	 */
+	void Deactivate() override;
+
+	/**
+	 * Returns this Interaction to a Pool
+	 * Interrupts Sessions, Releases Focus, Removes the Owner From Queries and Makes it Dormant
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = InteractionComponent)
+		void DeactivateInteraction();
+
+	/**
+	 * Reuses this Interaction From a Pool With Fresh State at a New Transform
+	 *
+	 * @param NewTransform - New World Transform of the Owner
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = InteractionComponent)
+		void ReactivateInteraction(const FTransform& NewTransform);
+
+	/**
+	 * Resets the Interaction Type Specific State to its Defaults, Used When Reusing From a Pool
+	 */
+	virtual void ResetInteractionState() {}
+
+	/**
+	 * Returns the Identifier Used to Persist this Interaction While its Level is Streamed Out
+	 *
+	 * @returns Stable Path Name for Level Placed Interactions, NAME_None If the Owner Was Spawned at Runtime
+	 */
+	FName GetPersistentId() const;
+
+	/**
+	 * Writes the Persistent State of this Interaction to a Compact Record
+	 */
+	virtual void WriteInteractionRecord(FInteractionRecord& OutRecord) const;
+
+	/**
+	 * Restores the Persistent State of this Interaction From a Record Without Replaying History
+	 */
+	virtual void ReadInteractionRecord(const FInteractionRecord& Record);
+
+	/**
+	 * Returns True If Any Interactor Is Currently Interacting With this Component
+	 */
+	UFUNCTION(BlueprintPure, Category = InteractionComponent)
+		virtual bool HasActiveInteraction() const
+	{
+		return false;
+	}
+
 	/**
 	 * Getter For Interaction Component Interaction Type
 	 */
@@ -125,10 +460,86 @@ protected:
 		EInteractionType InteractionType;
 
 	/**
-	 * Interactor Component Reference Currently Focusing on this Interaction
+	 * Focus of the Interactor Currently Focusing on this Interaction, @see UInteractorComponent::GetCandidateFocus
+	 * @note A Handle Into the Focus Table of the Interaction Subsystem, Stale Once the Interactor is Gone
+	 */
+	FInteractionHandle InteractorFocus;
+
+	/**
+	 * Returns the Interactor Currently Focusing on this Interaction, Resolved Through the Interactor Focus
+	 */
+	UInteractorComponent* GetFocusingInteractor() const;
+
+	/**
+	 * Whether the Interaction is Deactivated Into a Pool
+	 */
+	uint8 bPooled : 1;
+
+	/**
+	 * Owner Collision and Visibility Before Pooling, Restored on Reactivation
+	 */
+	uint8 bPooledCollisionEnabled : 1;
+	uint8 bPooledHidden : 1;
+
+	/**
+	 * Resolved Anchor Component When Using an Anchor
+	 */
+	UPROPERTY(Transient)
+		TWeakObjectPtr<USceneComponent> AnchorComponent;
+
+	/**
+	 * Handle of the Transform Update Binding of a Movable Anchor
+	 */
+	FDelegateHandle AnchorTransformHandle;
+
+	/**
+	 * Generated Proxy Shape Receiving Interaction Traces
+	 */
+	UPROPERTY(Transient)
+		UShapeComponent* ProxyComponent;
+
+	/**
+	 * Updates the Tag Index on Clients
+	 */
+	UFUNCTION()
+		void OnRep_InteractionTags();
+
+	/**
+	 * Delivers the Pending Group Result to Members Resolved Since the Last Fan Out
+	 * @note Also Invoked When Member References Unresolved on this Client are Mapped
+	 */
+	UFUNCTION()
+		void OnRep_GroupMemberActors();
+
+	/**
+	 * Resolves the Anchor Component and Detaches From the Parent in Game Worlds
+	 */
+	void ResolveAnchor(bool bGameWorld);
+
+	/**
+	 * Creates and Attaches the Proxy Shape
+	 */
+	void CreateProxyComponent();
+
+	/**
+	 * Releases the Focus of the Focusing Interactor
+	 */
+	void ReleaseInteractionFocus();
+
+	/**
+	 * Returns the World Transform of the Anchor Socket
 	 */
-	UPROPERTY()
-		UInteractorComponent* FocusingInteractor;
+	FTransform GetAnchorTransform() const;
+
+	/**
+	 * Updates the Tag Index Location When a Movable Anchor Moves, Anchored Components are Detached and Not Updated Themselves
+	 */
+	void OnAnchorTransformUpdated(USceneComponent* UpdatedComponent, EUpdateTransformFlags UpdateTransformFlags, ETeleportType Teleport);
+
+	/**
+	 * Updates the Location of a Tagged Interaction in the Tag Index
+	 */
+	void UpdateInteractionIndexLocation();
 
 	/**
 	 * Completes an Interaction With an Interactor
@@ -150,11 +561,48 @@ protected:
 		void NotifyInteraction(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent);
 
 	/**
-	 * Multi Cast Call to all Clients Notifying Interaction State
+	 * Reliable Multi Cast Call to all Clients Notifying the Terminal Interaction State
+	 * @note Ignored by the Interactor Owner, the Interactor Forwards its Reliable Owner Notification
 	 *
 	 * @param InteractionResult - Result of the Interaction
 	 * @param InteractionType - Type of Interaction
+	 * @param Sequence - Observer Sequence, Stale Notifications are Discarded
 	 */
 	UFUNCTION(NetMulticast, Reliable)
-		void Multi_NotifyInteraction(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent);
+		void Multi_NotifyInteraction(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent, uint8 Sequence);
+
+	/**
+	 * Reliable Multi Cast Call to all Clients Notifying the Terminal Interaction State of this Interaction and its Group Members
+	 *
+	 * @param InteractionResult - Result of the Interaction
+	 * @param NewInteractionComponent - Interactor of the Interaction
+	 * @param Sequence - Observer Sequence, Stale Notifications are Discarded
+	 */
+	UFUNCTION(NetMulticast, Reliable)
+		void Multi_NotifyGroupInteraction(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent, uint8 Sequence);
+
+	/**
+	 * Sequence of Observer Notifications
+	 */
+	FInteractionNotificationSequence ObserverSequence;
+
+	/**
+	 * Broadcasts the Interaction State Locally on Each Group Member
+	 */
+	void FanOutGroupInteraction(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent);
+
+	/**
+	 * Broadcasts the Interaction State Locally on the Group Members Not Yet Delivered
+	 *
+	 * @returns True If Every Member Has Been Delivered
+	 */
+	bool DeliverGroupInteraction(EInteractionResult NewInteractionResult, UInteractorComponent* NewInteractionComponent);
+
+	/**
+	 * Last Group Result and the Members it Was Delivered To, Kept on Clients While Members are Unresolved
+	 */
+	EInteractionResult PendingGroupResult;
+	TWeakObjectPtr<UInteractorComponent> PendingGroupInteractor;
+	TArray<TWeakObjectPtr<AActor>> DeliveredGroupMembers;
+	bool bGroupResultPending;
 };
@@ -4,8 +4,37 @@
 
 #include "CoreMinimal.h"
 #include "InteractionComponents/InteractionComponent.h"
+#include "InteractionSession.h"
 #include "InteractionComponent_Hold.generated.h"
 
+class UInteractionSubsystem;
+
+/**
+ * Interactor Waiting for a Single Interaction Hold Component to Become Available
+ */
+USTRUCT()
+struct FInteractionQueueEntry
+{
+	GENERATED_BODY()
+
+	/** Queued Interactor Component, Weak So a Destroyed Interactor Never Lingers in the Queue */
+	UPROPERTY()
+		TWeakObjectPtr<UInteractorComponent> Interactor;
+
+	/** Priority of the Interactor at the Time of Queueing */
+	UPROPERTY()
+		int32 Priority;
+
+	FInteractionQueueEntry()
+		:Priority(0)
+	{}
+
+	FInteractionQueueEntry(UInteractorComponent* NewInteractor, int32 NewPriority)
+		:Interactor(NewInteractor)
+		,Priority(NewPriority)
+	{}
+};
+
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class INTERACTIONPLUGIN_API UInteractionComponent_Hold : public UInteractionComponent
 {
@@ -51,31 +80,147 @@ public:
 	bool CanInteractWith(UInteractorComponent* InteractoComp) override;
 
 	/**
-	 * Getter for the Interaction Duration
+	 * [Overridden] Queues an Interactor Rejected Due to an Interaction Already In Progress
+	 *
+	 * @param InteractorComp - Interactor Component Trying to Interact
+	 * @returns True If the Interactor Was Queued
+	 */
+	bool TryQueueInteraction(UInteractorComponent* InteractorComp) override;
+
+	/**
+	 * [Overridden] Interrupts All Interactors Holding or Queued on this Interaction
+	 */
+	void InterruptAllInteractions() override;
+
+	/**
+	 * [Overridden] Clears the Interactors and the Queue
+	 */
+	void ResetInteractionState() override;
+
+	/**
+	 * [Overridden] Returns True If Any Interactor Is Holding this Interaction
+	 */
+	bool HasActiveInteraction() const override
+	{
+		return GetNumActiveSessions() > 0;
+	}
+
+	/**
+	 * Getter for the Interaction Duration From the Definition or the Override
 	 */
 	UFUNCTION(BlueprintGetter, Category = InteractionConfig)
 		float GetInteractionDuration() const
 	{
-		return InteractionDuration;
+		return Definition != nullptr && !bOverride_InteractionDuration ? Definition->InteractionDuration : InteractionDuration;
 	};
 
 	/**
-	 * Setter for the Interaction Duration
+	 * Setter for the Interaction Duration, Overrides the Definition
 	 */
 	UFUNCTION(BlueprintSetter, Category = InteractionConfig)
 		void SetInteractionDuration(const float NewInteractionDuration)
 	{
 		InteractionDuration = NewInteractionDuration;
+		bOverride_InteractionDuration = true;
 	};
 
+	/**
+	 * Returns Whether Rejected Interactors are Queued From the Definition or the Override
+	 */
+	UFUNCTION(BlueprintGetter, Category = InteractionConfig)
+		bool ShouldQueueInteractors() const
+	{
+		return Definition != nullptr && !bOverride_Queue ? Definition->bQueueInteractors : bQueueInteractors;
+	}
+
+	/**
+	 * Returns the Effective Maximum Queue Length and Promotion Order
+	 */
+	UFUNCTION(BlueprintGetter, Category = InteractionConfig)
+		int32 GetMaxQueuedInteractors() const;
+
+	UFUNCTION(BlueprintGetter, Category = InteractionConfig)
+		EInteractionQueueOrder GetQueueOrder() const;
+
+	/**
+	 * Setters for the Queue Settings, Override the Queue Settings of the Definition
+	 */
+	UFUNCTION(BlueprintSetter, Category = InteractionConfig)
+		void SetQueueInteractors(const bool bNewQueueInteractors);
+
+	UFUNCTION(BlueprintSetter, Category = InteractionConfig)
+		void SetMaxQueuedInteractors(const int32 NewMaxQueuedInteractors);
+
+	UFUNCTION(BlueprintSetter, Category = InteractionConfig)
+		void SetQueueOrder(const EInteractionQueueOrder NewQueueOrder);
+
+	/** [Config] Override the Interaction Duration of the Definition */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "InteractionComponent|Overrides")
+		uint8 bOverride_InteractionDuration : 1;
+
+	/** [Config] Override the Queue Settings of the Definition */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "InteractionComponent|Overrides")
+		uint8 bOverride_Queue : 1;
+
 protected:
 
 	/** Duration Required for the Interaction to be Completed */
-	UPROPERTY(EditAnywhere, Category = "InteractionComponent|Config", BlueprintGetter = GetInteractionDuration, BlueprintSetter = SetInteractionDuration,meta = (ClampMin = 0.0f))
+	UPROPERTY(EditAnywhere, Category = "InteractionComponent|Config", BlueprintGetter = GetInteractionDuration, BlueprintSetter = SetInteractionDuration,meta = (ClampMin = 0.0f, EditCondition = "bOverride_InteractionDuration || Definition == nullptr"))
 		float InteractionDuration;
 
+	/**
+	 * [Config] Boolean to Queue Interactors Rejected Due to an Interaction Already In Progress
+	 * Queued Interactors are Promoted Automatically When the Current Interaction Ends
+	 * @note Only Applies If Multiple Interaction is Not Allowed
+	 */
+	UPROPERTY(EditAnywhere, BlueprintGetter = ShouldQueueInteractors, BlueprintSetter = SetQueueInteractors, Category = "InteractionComponent|Queue", meta = (EditCondition = "bOverride_Queue || Definition == nullptr"))
+		bool bQueueInteractors;
+
+	/**
+	 * [Config] Maximum Number of Interactors Waiting in the Queue
+	 */
+	UPROPERTY(EditAnywhere, BlueprintGetter = GetMaxQueuedInteractors, BlueprintSetter = SetMaxQueuedInteractors, Category = "InteractionComponent|Queue", meta = (ClampMin = 1, EditCondition = "(bOverride_Queue || Definition == nullptr) && bQueueInteractors"))
+		int32 MaxQueuedInteractors;
+
+	/**
+	 * [Config] Order in Which Queued Interactors are Promoted
+	 *
+	 * FIFO		 : Interactors are Promoted in the Order They Were Queued
+	 * Priority	 : Higher Interactor Queue Priority is Promoted First, FIFO Among Equal Priorities
+	 */
+	UPROPERTY(EditAnywhere, BlueprintGetter = GetQueueOrder, BlueprintSetter = SetQueueOrder, Category = "InteractionComponent|Queue", meta = (EditCondition = "(bOverride_Queue || Definition == nullptr) && bQueueInteractors"))
+		EInteractionQueueOrder QueueOrder;
+
 private:
 
+	/**
+	 * Returns True If No Further Interactor Can Start Until the Current Interaction Ends
+	 */
+	bool IsOccupied() const;
+
+	/**
+	 * Returns the Number of Sessions Holding this Interaction Whose Interactor is Still Alive
+	 * @note Stale Handles are Skipped, Not Removed, @see PruneInteractionSessions
+	 */
+	int32 GetNumActiveSessions() const;
+
+	/**
+	 * Enables the Queue Override, Starting From the Queue Settings of the Definition
+	 */
+	void OverrideQueue();
+
+	/**
+	 * Removes an Interactor from the Queue
+	 *
+	 * @returns True If the Interactor Was Queued
+	 */
+	bool RemoveQueuedInteractor(UInteractorComponent* InteractorComponent);
+
+	/**
+	 * Starts the Interaction for the Next Valid Queued Interactor If Not Occupied
+	 */
+	void PromoteQueuedInteractor();
+
 	/**
 	 * Calculates and Returns If the Initiated Interaction Time Plus the Interaction Required Duration has already been passed.
 	 *
@@ -86,15 +231,41 @@ private:
 		inline bool IsInteractionTimeOver(const UInteractorComponent* InteractorComponent) const;
 
 	/**
-	 * Adds Interactor and the Current Game World Time to the Interactor Map 
+	 * Adds the Session of the Interactor, Holding its Initiation Game Time
 	 */
 	UFUNCTION()
 		void AddInteractor(UInteractorComponent* InteractorComponent);
 
 	/**
-	 * Map of Interactors to Interaction Initiation Game Time
+	 * Returns True If the Interactor is Holding this Interaction
+	 */
+	bool HasInteractor(const UInteractorComponent* InteractorComponent) const;
+
+	/**
+	 * Removes the Handles of Sessions that Ended or Whose Interactor is Gone
+	 * @note Called From the Session Start and End Paths, the Interaction Subsystem Releases Dead Sessions
+	 */
+	void PruneInteractionSessions();
+
+	/**
+	 * Returns the Session Table of the World, Null Without an Interaction Subsystem
+	 */
+	const FInteractionSessionTable* GetSessionTable() const;
+
+	/**
+	 * Returns the Interaction Subsystem of the World Owning the Sessions
+	 */
+	UInteractionSubsystem* GetInteractionSubsystem() const;
+
+	/**
+	 * Handles of the Sessions Holding this Interaction
+	 */
+	TArray<FInteractionHandle> InteractionSessions;
+
+	/**
+	 * Interactors Waiting for the Interaction in Promotion Order
 	 */
 	UPROPERTY()
-		TMap<UInteractorComponent*, float> Interactors;
+		TArray<FInteractionQueueEntry> QueuedInteractors;
 		
 };
@@ -0,0 +1,231 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/NetSerialization.h"
+#include "InteractionComponents/InteractionComponent_Hold.h"
+#include "InteractionComponent_Instanced.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UInteractionComponent_Instanced;
+
+/**
+ * Replicated State of a Single Instance That Differs From the Default State
+ */
+USTRUCT()
+struct FInteractionInstanceState : public FFastArraySerializerItem
+{
+	GENERATED_BODY()
+
+	/** Index of the Instance in the Instanced Static Mesh */
+	UPROPERTY()
+		int32 InstanceIndex;
+
+	/** Whether the Instance Has Been Consumed by a Successful Interaction */
+	UPROPERTY()
+		bool bConsumed;
+
+	FInteractionInstanceState()
+		:InstanceIndex(INDEX_NONE)
+		,bConsumed(false)
+	{}
+
+	void PreReplicatedRemove(const struct FInteractionInstanceStateArray& InArraySerializer);
+	void PostReplicatedAdd(const struct FInteractionInstanceStateArray& InArraySerializer);
+	void PostReplicatedChange(const struct FInteractionInstanceStateArray& InArraySerializer);
+};
+
+/**
+ * Sparse Array of Instance States, Only Instances Changed From the Default State are Replicated
+ * Entries are Removed Once their Instance Returns to the Default State
+ */
+USTRUCT()
+struct FInteractionInstanceStateArray : public FFastArraySerializer
+{
+	GENERATED_BODY()
+
+	/** Changed Instance States */
+	UPROPERTY()
+		TArray<FInteractionInstanceState> Items;
+
+	/** Component Owning the Array */
+	UPROPERTY(NotReplicated)
+		UInteractionComponent_Instanced* OwnerComponent;
+
+	FInteractionInstanceStateArray()
+		:OwnerComponent(nullptr)
+	{}
+
+	bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+	{
+		return FFastArraySerializer::FastArrayDeltaSerialize<FInteractionInstanceState, FInteractionInstanceStateArray>(Items, DeltaParms, *this);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FInteractionInstanceStateArray> : public TStructOpsTypeTraitsBase2<FInteractionInstanceStateArray>
+{
+	enum
+	{
+		WithNetDeltaSerializer = true
+	};
+};
+
+/**
+ * Hold Interaction Handling Every Instance of an Instanced Static Mesh as a Separate Interactable
+ * Removes the Need to Spawn an Actor per Harvestable or Lootable Prop
+ *
+ * @note Interactors are Mapped to Instances Through the Hit Item of their Interaction Trace
+ */
+UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
+class INTERACTIONPLUGIN_API UInteractionComponent_Instanced : public UInteractionComponent_Hold
+{
+	GENERATED_BODY()
+
+public:
+
+	// Sets default values for this component's properties
+	UInteractionComponent_Instanced();
+
+	/**
+	 * Returns the properties used for network replication
+	 */
+	void GetLifetimeReplicatedProps(TArray< FLifetimeProperty > & OutLifetimeProps) const override;
+
+	/**
+	 * Resolves the Instanced Static Mesh Component
+	 */
+	void OnRegister() override;
+
+	/**
+	 * [Config] Name of the Owner Instanced Static Mesh Component, First Found If None
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "InteractionComponent|Instanced")
+		FName InstancedMeshName;
+
+	/**
+	 * [Config] Boolean to Consume and Hide an Instance After a Successful Interaction
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "InteractionComponent|Instanced")
+		bool bConsumeOnSuccess;
+
+	/**
+	 * [Config] Per Instance Custom Data Float Set to 1 For Consumed Instances and 0 Otherwise
+	 * @note The Mesh Material Hides Consumed Instances by Reading this Float, E.g Through Opacity Mask
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "InteractionComponent|Instanced", meta = (ClampMin = "0"))
+		int32 ConsumedCustomDataIndex;
+
+	/**
+	 * [Overridden] Starts Interaction With the Instance the Interactor is Focusing
+	 */
+	bool StartInteraction(UInteractorComponent* InteractorComp) override;
+
+	/**
+	 * [Overridden] Validates the Interactor Instance is Available and Conditions are Met
+	 */
+	bool CanInteractWith(UInteractorComponent* InteractorComp) override;
+
+	/**
+	 * [Overridden] Queueing is Not Supported per Instance
+	 */
+	bool TryQueueInteraction(UInteractorComponent* InteractorComp) override
+	{
+		return false;
+	}
+
+	/**
+	 * [Overridden] Resolves the Hit Instance Index, Rejecting Hits on Other Components and Consumed Instances
+	 */
+	bool ResolveInteractionItem(const FHitResult& Hit, int32& OutItem) const override;
+
+	/**
+	 * [Overridden] Returns the Number of Instances
+	 */
+	int32 GetNumInteractionItems() const override;
+
+	/**
+	 * [Overridden] Returns the World Location of an Instance
+	 */
+	FVector GetInteractionLocation(int32 Item = -1) const override;
+
+	/**
+	 * [Overridden] Returns the World Forward Vector of an Instance
+	 */
+	FVector GetInteractionForwardVector(int32 Item = -1) const override;
+
+	/**
+	 * [Overridden] Restores All Consumed Instances
+	 */
+	void ResetInteractionState() override;
+
+	/**
+	 * [Overridden] Writes the Consumed Instances as a Packed Bit Array
+	 */
+	void WriteInteractionRecord(FInteractionRecord& OutRecord) const override;
+
+	/**
+	 * [Overridden] Restores the Consumed Instances From a Packed Bit Array
+	 */
+	void ReadInteractionRecord(const FInteractionRecord& Record) override;
+
+	/**
+	 * Returns True If an Instance Has Been Consumed
+	 */
+	UFUNCTION(BlueprintPure, Category = InteractionComponent)
+		bool IsInstanceConsumed(int32 InstanceIndex) const;
+
+	/**
+	 * Sets the Consumed State of an Instance on Authority and Replicates it
+	 */
+	UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category = InteractionComponent)
+		void SetInstanceConsumed(int32 InstanceIndex, bool bConsumed);
+
+	/**
+	 * Applies a Replicated or Local Instance State to the Instanced Mesh
+	 */
+	void ApplyInstanceState(int32 InstanceIndex, bool bConsumed);
+
+protected:
+
+	/**
+	 * [Overridden] Consumes the Instance on Success and Releases the Interactor Instance
+	 */
+	void CompleteInteraction(EInteractionResult InteractionResult, UInteractorComponent* InteractorComp) override;
+
+private:
+
+	/**
+	 * Returns True If the Instance is Valid and Not Consumed
+	 */
+	bool IsInstanceAvailable(int32 InstanceIndex) const;
+
+	/**
+	 * Returns True If Another Interactor is Interacting With the Instance and Multiple Interaction is Not Allowed
+	 */
+	bool IsInstanceOccupied(int32 InstanceIndex) const;
+
+	/**
+	 * Instanced Static Mesh Handled by this Component
+	 */
+	UPROPERTY(Transient)
+		UInstancedStaticMeshComponent* InstancedMesh;
+
+	/**
+	 * Replicated Sparse Instance States
+	 */
+	UPROPERTY(Replicated)
+		FInteractionInstanceStateArray InstanceStates;
+
+	/**
+	 * Packed Consumed Flag per Instance, Mirrors the Instance States
+	 */
+	TBitArray<> ConsumedInstances;
+
+	/**
+	 * Map of Interactors to the Instance They are Interacting With
+	 * @note Weak Keys, a Destroyed Interactor No Longer Occupies its Instance
+	 */
+	TMap<TWeakObjectPtr<UInteractorComponent>, int32> InteractorInstances;
+};
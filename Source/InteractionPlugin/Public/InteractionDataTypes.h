@@ -2,6 +2,12 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "UObject/SoftObjectPtr.h"
+#include "InteractionDataTypes.generated.h"
+
+class UTexture2D;
+class UAnimMontage;
+class USoundBase;
 
 UENUM(BlueprintType)
 enum class EInteractionResult : uint8
@@ -10,7 +16,8 @@ enum class EInteractionResult : uint8
 	IR_Started		UMETA(DisplayName = "Started"),
 	IR_Successful	UMETA(DisplayName = "Successful"),
 	IR_Failed		UMETA(DisplayName = "Failed"),
-	IR_Interrupted	UMETA(DisplayName = "Interrupted")
+	IR_Interrupted	UMETA(DisplayName = "Interrupted"),
+	IR_Queued		UMETA(DisplayName = "Queued")
 };
 
 UENUM(BlueprintType)
@@ -29,3 +36,265 @@ enum class EInteractionNetMode : uint8
 	INM_All			UMETA(DisplayName = "All")
 };
 
+UENUM(BlueprintType)
+enum class EInteractionQueueOrder : uint8
+{
+	IQO_FIFO		UMETA(DisplayName = "First In First Out"),
+	IQO_Priority	UMETA(DisplayName = "Priority")
+};
+
+UENUM(BlueprintType)
+enum class EInteractionProxyShape : uint8
+{
+	IPS_None		UMETA(DisplayName = "None"),
+	IPS_Sphere		UMETA(DisplayName = "Sphere"),
+	IPS_Box			UMETA(DisplayName = "Box"),
+	IPS_Capsule		UMETA(DisplayName = "Capsule"),
+	IPS_Owner		UMETA(DisplayName = "Owner Primitive")
+};
+
+/**
+ * Soft References to the Prompt and Feedback Assets of an Interaction
+ * Prefetched Asynchronously While the Interaction is Near the Local Interactor
+ */
+USTRUCT(BlueprintType)
+struct FInteractionFeedbackAssets
+{
+	GENERATED_BODY()
+
+	/** Prompt Widget Class Shown When In Focus */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Interaction, meta = (AllowedClasses = "UserWidget"))
+		TSoftClassPtr<UObject> PromptWidgetClass;
+
+	/** Icon Shown by the Prompt */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Interaction)
+		TSoftObjectPtr<UTexture2D> Icon;
+
+	/** Montage Played by the Interactor */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Interaction)
+		TSoftObjectPtr<UAnimMontage> Montage;
+
+	/** Sound Played on Interaction */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = Interaction)
+		TSoftObjectPtr<USoundBase> Sound;
+
+	/**
+	 * Appends the Paths of the Set Assets
+	 */
+	void GetAssetPaths(TArray<FSoftObjectPath>& OutPaths) const
+	{
+		for (const FSoftObjectPath& Path : { PromptWidgetClass.ToSoftObjectPath(), Icon.ToSoftObjectPath(), Montage.ToSoftObjectPath(), Sound.ToSoftObjectPath() })
+		{
+			if (!Path.IsNull())
+			{
+				OutPaths.Add(Path);
+			}
+		}
+	}
+
+	/**
+	 * Returns True If Any Asset is Set
+	 */
+	bool HasAssets() const
+	{
+		return !PromptWidgetClass.IsNull() || !Icon.IsNull() || !Montage.IsNull() || !Sound.IsNull();
+	}
+};
+
+/**
+ * Token Bucket Used to Limit the Rate of Interaction Requests
+ */
+struct FInteractionTokenBucket
+{
+	/** Tokens Currently Available */
+	float Tokens;
+
+	/** Time Tokens Were Last Refilled */
+	float LastRefillTime;
+
+	/** Whether the Bucket Has Been Filled for the First Time */
+	bool bInitialized;
+
+	FInteractionTokenBucket()
+		:Tokens(0.0f)
+		,LastRefillTime(0.0f)
+		,bInitialized(false)
+	{}
+
+	/**
+	 * Refills the Bucket and Tries to Consume a Single Token
+	 *
+	 * @param CurrentTime - Current Time in Seconds
+	 * @param Rate - Tokens Refilled per Second, Zero or Less Disables Limiting
+	 * @param Burst - Maximum Tokens the Bucket Can Hold
+	 * @returns True If a Token Was Consumed
+	 */
+	bool TryConsume(float CurrentTime, float Rate, float Burst)
+	{
+		if (Rate <= 0.0f)
+		{
+			return true;
+		}
+
+		const float Capacity = FMath::Max(Burst, 1.0f);
+
+		if (!bInitialized)
+		{
+			Tokens = Capacity;
+			bInitialized = true;
+		}
+		else
+		{
+			Tokens = FMath::Min(Capacity, Tokens + FMath::Max(CurrentTime - LastRefillTime, 0.0f) * Rate);
+		}
+
+		LastRefillTime = CurrentTime;
+
+		if (Tokens < 1.0f)
+		{
+			return false;
+		}
+
+		Tokens -= 1.0f;
+		return true;
+	}
+};
+
+/**
+ * Sequence Numbers of Observer Notifications, Used to Discard Stale Events
+ */
+struct FInteractionNotificationSequence
+{
+	/** Last Sequence Sent by the Server */
+	uint8 Outgoing;
+
+	/** Last Sequence Accepted by this Client */
+	uint8 LastReceived;
+
+	/** Whether a Sequence Has Been Accepted Yet */
+	bool bReceived;
+
+	FInteractionNotificationSequence()
+		:Outgoing(0)
+		,LastReceived(0)
+		,bReceived(false)
+	{}
+
+	/**
+	 * Returns the Sequence of the Next Outgoing Notification
+	 */
+	uint8 Next()
+	{
+		return ++Outgoing;
+	}
+
+	/**
+	 * Accepts a Received Sequence If it is Newer Than the Last Accepted, Handling Wrap Around
+	 *
+	 * @returns False If the Notification is Stale and Must be Discarded
+	 */
+	bool Accept(uint8 Sequence)
+	{
+		if (bReceived && static_cast<int8>(Sequence - LastReceived) <= 0)
+		{
+			return false;
+		}
+
+		LastReceived = Sequence;
+		bReceived = true;
+		return true;
+	}
+
+	/**
+	 * Returns True If the Result Ends an Interaction, Terminal Notifications are Sent Reliably
+	 */
+	static FORCEINLINE bool IsTerminal(EInteractionResult Result)
+	{
+		return Result == EInteractionResult::IR_Successful ||
+			Result == EInteractionResult::IR_Failed ||
+			Result == EInteractionResult::IR_Interrupted;
+	}
+};
+
+/**
+ * Server Authoritative Progress of a Hold Interaction
+ * Expressed as a Server Start Time Plus Duration so Clients Can Interpolate Without Per Tick Updates
+ */
+USTRUCT(BlueprintType)
+struct INTERACTIONPLUGIN_API FInteractionHoldProgress
+{
+	GENERATED_BODY()
+
+	/** Server World Time the Hold Started At */
+	UPROPERTY(BlueprintReadOnly, Category = Interaction)
+		float StartServerTime;
+
+	/** Duration Required to Complete the Hold, Zero If No Hold In Progress */
+	UPROPERTY(BlueprintReadOnly, Category = Interaction)
+		float Duration;
+
+	FInteractionHoldProgress()
+		:StartServerTime(0.0f)
+		,Duration(0.0f)
+	{}
+
+	FInteractionHoldProgress(float NewStartServerTime, float NewDuration)
+		:StartServerTime(NewStartServerTime)
+		,Duration(NewDuration)
+	{}
+
+	/**
+	 * Returns True If a Hold is In Progress
+	 */
+	FORCEINLINE bool IsActive() const
+	{
+		return Duration > 0.0f;
+	}
+
+	/**
+	 * Returns the Normalized Progress at a Given Server Time
+	 */
+	FORCEINLINE float GetProgress(float ServerTime) const
+	{
+		return IsActive() ? FMath::Clamp((ServerTime - StartServerTime) / Duration, 0.0f, 1.0f) : 0.0f;
+	}
+
+	/**
+	 * Serializes the Start Time and the Duration Quantized to Centiseconds
+	 */
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+	{
+		Ar << StartServerTime;
+
+		uint16 QuantizedDuration = (uint16)FMath::Clamp(FMath::RoundToInt(Duration * 100.0f), 0, (int32)MAX_uint16);
+		Ar << QuantizedDuration;
+
+		if (Ar.IsLoading())
+		{
+			Duration = QuantizedDuration / 100.0f;
+		}
+
+		bOutSuccess = true;
+		return true;
+	}
+
+	bool operator==(const FInteractionHoldProgress& Other) const
+	{
+		return StartServerTime == Other.StartServerTime && Duration == Other.Duration;
+	}
+
+	bool operator!=(const FInteractionHoldProgress& Other) const
+	{
+		return !(*this == Other);
+	}
+};
+
+template<>
+struct TStructOpsTypeTraits<FInteractionHoldProgress> : public TStructOpsTypeTraitsBase2<FInteractionHoldProgress>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithIdenticalViaEquality = true
+	};
+};
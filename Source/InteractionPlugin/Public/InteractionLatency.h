@@ -0,0 +1,170 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+#pragma once
+
+#include "CoreMinimal.h"
+#include <atomic>
+
+/**
+ * Fixed Size Lock Free Latency Histogram
+ * Buckets Grow Exponentially, Four Buckets per Doubling, Covering 0 to 65 Seconds
+ */
+struct FInteractionLatencyHistogram
+{
+	/** Number of Buckets */
+	static constexpr int32 NumBuckets = 64;
+
+	/** Buckets per Doubling of the Latency */
+	static constexpr float BucketsPerOctave = 4.0f;
+
+	FInteractionLatencyHistogram()
+	{
+		Reset();
+	}
+
+	/**
+	 * Adds a Sample, Safe to Call From Any Thread
+	 *
+	 * @param LatencyMs - Latency in Milliseconds
+	 */
+	void AddSample(float LatencyMs)
+	{
+		Buckets[GetBucketIndex(LatencyMs)].fetch_add(1, std::memory_order_relaxed);
+		SampleCount.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	/**
+	 * Returns the Latency in Milliseconds Below Which the Given Fraction of Samples Fall
+	 *
+	 * @param Percentile - Fraction Between 0 and 1
+	 * @returns Upper Bound of the Bucket Holding the Percentile, Zero If No Samples
+	 */
+	float GetPercentile(float Percentile) const
+	{
+		const uint32 Total = SampleCount.load(std::memory_order_relaxed);
+		if (Total == 0)
+		{
+			return 0.0f;
+		}
+
+		const uint32 Target = FMath::Max<uint32>(1, FMath::CeilToInt(FMath::Clamp(Percentile, 0.0f, 1.0f) * Total));
+		uint32 Accumulated = 0;
+
+		for (int32 Index = 0; Index < NumBuckets; ++Index)
+		{
+			Accumulated += Buckets[Index].load(std::memory_order_relaxed);
+
+			if (Accumulated >= Target)
+			{
+				return GetBucketUpperBound(Index);
+			}
+		}
+
+		return GetBucketUpperBound(NumBuckets - 1);
+	}
+
+	/**
+	 * Returns the Number of Samples
+	 */
+	uint32 GetSampleCount() const
+	{
+		return SampleCount.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Returns the Number of Samples in a Bucket
+	 */
+	uint32 GetBucketCount(int32 Index) const
+	{
+		return Buckets[Index].load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Returns the Upper Bound in Milliseconds of a Bucket
+	 */
+	static float GetBucketUpperBound(int32 Index)
+	{
+		return FMath::Pow(2.0f, (Index + 1) / BucketsPerOctave) - 1.0f;
+	}
+
+	/**
+	 * Clears All Samples
+	 */
+	void Reset()
+	{
+		for (std::atomic<uint32>& Bucket : Buckets)
+		{
+			Bucket.store(0, std::memory_order_relaxed);
+		}
+
+		SampleCount.store(0, std::memory_order_relaxed);
+	}
+
+private:
+
+	/**
+	 * Returns the Bucket of a Latency
+	 */
+	static int32 GetBucketIndex(float LatencyMs)
+	{
+		const float Octaves = FMath::Log2(FMath::Max(LatencyMs, 0.0f) + 1.0f);
+
+		return FMath::Clamp(FMath::FloorToInt(Octaves * BucketsPerOctave), 0, NumBuckets - 1);
+	}
+
+	/** Sample Count per Bucket */
+	std::atomic<uint32> Buckets[NumBuckets];
+
+	/** Total Sample Count */
+	std::atomic<uint32> SampleCount;
+};
+
+/**
+ * Stages of the Interaction Request Path With a Latency Histogram
+ */
+enum class EInteractionLatencyStage : uint8
+{
+	/** Client Request to the First Notification Arriving Back, Measured on the Client Clock and Reported */
+	ILS_RoundTrip,
+
+	/** Server Request Received to the Synchronous Handling Returning, Including the Interaction Start but Not Queue Waits */
+	ILS_Server,
+
+	ILS_Count
+};
+
+/**
+ * Latency Histograms of Every Stage
+ */
+struct FInteractionLatencyStages
+{
+	FInteractionLatencyHistogram Stages[static_cast<int32>(EInteractionLatencyStage::ILS_Count)];
+
+	FInteractionLatencyHistogram& operator[](EInteractionLatencyStage Stage)
+	{
+		return Stages[static_cast<int32>(Stage)];
+	}
+
+	const FInteractionLatencyHistogram& operator[](EInteractionLatencyStage Stage) const
+	{
+		return Stages[static_cast<int32>(Stage)];
+	}
+
+	/**
+	 * Returns the Display Name of a Stage
+	 */
+	static const TCHAR* GetStageName(EInteractionLatencyStage Stage)
+	{
+		return Stage == EInteractionLatencyStage::ILS_RoundTrip ? TEXT("RoundTrip") : TEXT("Server");
+	}
+
+	/**
+	 * Clears All Stages
+	 */
+	void Reset()
+	{
+		for (FInteractionLatencyHistogram& Histogram : Stages)
+		{
+			Histogram.Reset();
+		}
+	}
+};
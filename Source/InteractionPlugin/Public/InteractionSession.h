@@ -0,0 +1,281 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UInteractorComponent;
+class UInteractionComponent;
+
+/**
+ * Compact Handle of an Interaction Session, an Index Into the Session Table Plus the Generation of the Slot
+ * Handles of Ended Sessions Never Resolve Again as the Slot Generation Changes on Release
+ */
+struct FInteractionHandle
+{
+	/** Slot Index in the Session Table */
+	uint32 Index;
+
+	/** Generation of the Slot When the Session Began, Zero Means Invalid */
+	uint32 Generation;
+
+	FInteractionHandle()
+		:Index(0)
+		,Generation(0)
+	{}
+
+	FInteractionHandle(uint32 InIndex, uint32 InGeneration)
+		:Index(InIndex)
+		,Generation(InGeneration)
+	{}
+
+	/**
+	 * Returns True If the Handle Was Issued by a Session Table, Not Whether the Session is Still Alive
+	 */
+	FORCEINLINE bool IsValid() const
+	{
+		return Generation != 0;
+	}
+
+	FORCEINLINE void Reset()
+	{
+		Index = 0;
+		Generation = 0;
+	}
+
+	FORCEINLINE bool operator==(const FInteractionHandle& Other) const
+	{
+		return Index == Other.Index && Generation == Other.Generation;
+	}
+
+	FORCEINLINE bool operator!=(const FInteractionHandle& Other) const
+	{
+		return !(*this == Other);
+	}
+
+	friend FORCEINLINE uint32 GetTypeHash(const FInteractionHandle& Handle)
+	{
+		return HashCombine(Handle.Index, Handle.Generation);
+	}
+};
+
+/**
+ * Interaction In Progress Between an Interactor and an Interaction Component
+ * @note Weak References Only, the Session Never Keeps Either Component Alive
+ */
+struct FInteractionSession
+{
+	/** Interactor of the Session */
+	TWeakObjectPtr<UInteractorComponent> Interactor;
+
+	/** Interaction of the Session */
+	TWeakObjectPtr<UInteractionComponent> Interaction;
+
+	/** Game Time the Session Began */
+	float StartTime;
+
+	FInteractionSession()
+		:StartTime(0.0f)
+	{}
+
+	/**
+	 * Returns True If Both Sides of the Session are Still Alive
+	 */
+	FORCEINLINE bool IsAlive() const
+	{
+		return Interactor.IsValid() && Interaction.IsValid();
+	}
+};
+
+/**
+ * Interaction Session Captured by a Snapshot, Independent of the World it Was Captured In
+ * @see UInteractionSubsystem::CaptureSnapshot
+ */
+struct FInteractionSessionSnapshot
+{
+	/** Persistent Id of the Interactor, @see UInteractorComponent::GetPersistentId */
+	FString InteractorId;
+
+	/** Persistent Id of the Interaction, @see UInteractionComponent::GetPersistentId */
+	FName InteractionId;
+
+	/** Item Index of the Interaction */
+	int32 Item;
+
+	/** Seconds the Session Was In Progress When Captured, the Start Time is Rebased on Restore */
+	float ElapsedTime;
+
+	FInteractionSessionSnapshot()
+		:Item(INDEX_NONE)
+		,ElapsedTime(0.0f)
+	{}
+
+	friend FArchive& operator<<(FArchive& Ar, FInteractionSessionSnapshot& Session)
+	{
+		return Ar << Session.InteractorId << Session.InteractionId << Session.Item << Session.ElapsedTime;
+	}
+};
+
+/**
+ * Central Table of Interaction Sessions in Contiguous Storage
+ * Slots are Recycled Through a Free List and Bump their Generation on Release so Stale Handles Resolve in O(1)
+ */
+class FInteractionSessionTable
+{
+public:
+
+	FInteractionSessionTable()
+		:NumSessions(0)
+	{}
+
+	/**
+	 * Begins a Session and Returns its Handle
+	 */
+	FInteractionHandle Add(UInteractorComponent* Interactor, UInteractionComponent* Interaction, float StartTime)
+	{
+		int32 Index;
+
+		if (FreeSlots.Num() > 0)
+		{
+			Index = FreeSlots.Pop(false);
+		}
+		else
+		{
+			Index = Slots.AddDefaulted();
+		}
+
+		FSlot& Slot = Slots[Index];
+		Slot.Session.Interactor = Interactor;
+		Slot.Session.Interaction = Interaction;
+		Slot.Session.StartTime = StartTime;
+		Slot.bInUse = true;
+
+		++NumSessions;
+
+		return FInteractionHandle(Index, Slot.Generation);
+	}
+
+	/**
+	 * Ends a Session, Stale Handles are Ignored
+	 *
+	 * @returns True If the Session Was Ended
+	 */
+	bool Remove(FInteractionHandle Handle)
+	{
+		FSlot* Slot = FindSlot(Handle);
+		if (Slot == nullptr)
+		{
+			return false;
+		}
+
+		Slot->Session = FInteractionSession();
+		Slot->bInUse = false;
+
+		/* Skip Zero on Wrap Around, it Marks Invalid Handles */
+		Slot->Generation = Slot->Generation == MAX_uint32 ? 1 : Slot->Generation + 1;
+
+		FreeSlots.Add(Handle.Index);
+		--NumSessions;
+
+		return true;
+	}
+
+	/**
+	 * Returns the Session of a Handle, Null If the Handle is Stale
+	 */
+	FORCEINLINE const FInteractionSession* Find(FInteractionHandle Handle) const
+	{
+		const FSlot* Slot = const_cast<FInteractionSessionTable*>(this)->FindSlot(Handle);
+
+		return Slot != nullptr ? &Slot->Session : nullptr;
+	}
+
+	/**
+	 * Returns the Session of a Handle, Null If the Handle is Stale or Either Side of the Session is Gone
+	 */
+	FORCEINLINE const FInteractionSession* FindAlive(FInteractionHandle Handle) const
+	{
+		const FInteractionSession* Session = Find(Handle);
+
+		return Session != nullptr && Session->IsAlive() ? Session : nullptr;
+	}
+
+	/**
+	 * Invokes the Callable for Every Session in Slot Order
+	 */
+	template<typename FunctorType>
+	void ForEach(FunctorType&& Functor) const
+	{
+		for (int32 Index = 0; Index < Slots.Num(); ++Index)
+		{
+			if (Slots[Index].bInUse)
+			{
+				Functor(FInteractionHandle(Index, Slots[Index].Generation), Slots[Index].Session);
+			}
+		}
+	}
+
+	/**
+	 * Returns the Number of Sessions
+	 */
+	FORCEINLINE int32 Num() const
+	{
+		return NumSessions;
+	}
+
+	/**
+	 * Ends All Sessions, Every Handle Issued Before Becomes Stale
+	 */
+	void Reset()
+	{
+		for (int32 Index = 0; Index < Slots.Num(); ++Index)
+		{
+			if (Slots[Index].bInUse)
+			{
+				Remove(FInteractionHandle(Index, Slots[Index].Generation));
+			}
+		}
+	}
+
+private:
+
+	/**
+	 * Session Slot
+	 */
+	struct FSlot
+	{
+		FInteractionSession Session;
+
+		/** Current Generation, Starts at One */
+		uint32 Generation;
+
+		/** Whether the Slot Holds a Session */
+		bool bInUse;
+
+		FSlot()
+			:Generation(1)
+			,bInUse(false)
+		{}
+	};
+
+	FORCEINLINE FSlot* FindSlot(FInteractionHandle Handle)
+	{
+		if (!Handle.IsValid() || !Slots.IsValidIndex(Handle.Index))
+		{
+			return nullptr;
+		}
+
+		FSlot& Slot = Slots[Handle.Index];
+
+		return Slot.bInUse && Slot.Generation == Handle.Generation ? &Slot : nullptr;
+	}
+
+	/** Contiguous Session Slots */
+	TArray<FSlot> Slots;
+
+	/** Indices of Released Slots */
+	TArray<int32> FreeSlots;
+
+	/** Number of Slots in Use */
+	int32 NumSessions;
+};
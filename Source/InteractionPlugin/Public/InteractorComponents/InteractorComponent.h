@@ -5,11 +5,13 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "InteractionDataTypes.h"
+#include "InteractionSession.h"
 #include "InteractorComponent.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogInteractor, Log, All);
 
 class UInteractionComponent;
+class UInteractionSubsystem;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FOnInteractorStateChanged, EInteractionResult, InteractionResult, EInteractionType, InteractionType, float , InteractionDuration, AActor*, InteractionActor);
 
@@ -17,6 +19,42 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInteractingChanged, bool, bIsInte
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnNewInteraction, UInteractionComponent*, NewInteraction);
 
+/**
+ * Result of the Last Full Interaction Trace, Reused While the View Point Barely Moves
+ */
+struct FInteractionTraceCache
+{
+	/** View Location the Trace Started From */
+	FVector ViewLocation;
+
+	/** View Rotation the Trace Was Aimed With */
+	FRotator ViewRotation;
+
+	/** Bounds of the Hit Component */
+	FBox HitBounds;
+
+	/** Distance From the View Location to the Hit */
+	float HitDistance;
+
+	/** World Time of the Trace */
+	float TraceTime;
+
+	/** Interaction Resolved by the Trace */
+	TWeakObjectPtr<UInteractionComponent> InteractionComponent;
+
+	/** Whether the Cache Holds a Reusable Hit */
+	bool bValid;
+
+	FInteractionTraceCache()
+		:ViewLocation(FVector::ZeroVector)
+		,ViewRotation(FRotator::ZeroRotator)
+		,HitBounds(ForceInit)
+		,HitDistance(0.0f)
+		,TraceTime(0.0f)
+		,bValid(false)
+	{}
+};
+
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class INTERACTIONPLUGIN_API UInteractorComponent : public UActorComponent
 {
@@ -32,6 +70,11 @@ public:
 	 */
 	virtual void GetLifetimeReplicatedProps(TArray< FLifetimeProperty > & OutLifetimeProps) const override;
 
+	/**
+	 * Enables Hold Progress Replication Based on the Interactor and Interaction Net Modes
+	 */
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+
 	/**
 	* Ends Gameplay For this Component. Allows the Interaction to begin Asynchronous Cleanup
 	*/
@@ -71,6 +114,56 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Interactor|Config")
 		float InteractorReachLength;
 
+	/**
+	 * [Config] Priority of this Interactor When Queued on an Interaction Using Priority Queue Order
+	 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Interactor|Config")
+		int32 InteractionQueuePriority;
+
+	/**
+	 * [Config] Sustained Start/Stop Requests per Second the Server Accepts From this Interactor
+	 * @note Zero or Less Disables Interactor Rate Limiting, Connection Limits Still Apply
+	 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Interactor|RateLimit")
+		float ServerRequestRate;
+
+	/**
+	 * [Config] Maximum Burst of Start/Stop Requests the Server Accepts From this Interactor
+	 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Interactor|RateLimit", meta = (ClampMin = 1.0f))
+		float ServerRequestBurst;
+
+	/**
+	 * [Config] Boolean to Reuse the Last Trace Result While the View Point Barely Moves and Still Aims at the Focused Interaction
+	 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Interactor|Coherence")
+		bool bUseTraceCoherence;
+
+	/**
+	 * [Config] Maximum Age in Seconds of a Reused Trace Result Before a Full Trace is Forced
+	 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Interactor|Coherence", meta = (ClampMin = 0.0f, EditCondition = "bUseTraceCoherence"))
+		float TraceCoherenceMaxStaleness;
+
+	/**
+	 * [Config] Maximum View Location Change in Units to Reuse the Last Trace Result
+	 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Interactor|Coherence", meta = (ClampMin = 0.0f, EditCondition = "bUseTraceCoherence"))
+		float TraceCoherenceDistanceThreshold;
+
+	/**
+	 * [Config] Maximum View Rotation Change in Degrees to Reuse the Last Trace Result
+	 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Interactor|Coherence", meta = (ClampMin = 0.0f, EditCondition = "bUseTraceCoherence"))
+		float TraceCoherenceAngleThreshold;
+
+	/**
+	 * [Config] Boolean to Trace Against Complex Collision
+	 * @note Disable When Interactables Use Proxy Shapes or Simple Collision to Reduce Narrow Phase Cost
+	 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Interactor|Config")
+		bool bTraceComplex;
+
 
 #if WITH_EDITORONLY_DATA
 
@@ -103,6 +196,40 @@ public:
 	UFUNCTION()
 		void EndInteraction(EInteractionResult InteractionResult,UInteractionComponent* InteractionComponent);
 
+	/**
+	 * Starts the Interaction this Interactor Was Queued For, Invoked by the Interaction when Promoting the Queue
+	 *
+	 * @param QueuedInteraction - Interaction Component the Interactor Was Queued On
+	 * @returns True If the Interaction Started
+	 */
+	UFUNCTION()
+		bool StartQueuedInteraction(UInteractionComponent* QueuedInteraction);
+
+	/**
+	 * Returns the Normalized Progress of the Hold Interaction In Progress
+	 * @note Interpolated Locally From the Server Start Time, Valid on Server, Owner and Observers With Net Mode All
+	 */
+	UFUNCTION(BlueprintPure, Category = Interactor)
+		float GetHoldProgress() const;
+
+	/**
+	 * Returns the Server Authoritative Hold Progress State
+	 */
+	UFUNCTION(BlueprintPure, Category = Interactor)
+		const FInteractionHoldProgress& GetHoldProgressState() const
+	{
+		return HoldProgress;
+	}
+
+	/**
+	 * Returns True If the Interactor is Waiting in an Interaction Queue
+	 */
+	UFUNCTION(BlueprintPure, Category = Interactor)
+		FORCEINLINE bool IsInteractionQueued() const
+	{
+		return bInteractionQueued;
+	}
+
 	/**
 	 * Ends Interaction Focus, Usually Invoked by the Interaction when Destroying
 	 */
@@ -165,13 +292,58 @@ public:
 	 * Performs an Interaction Trace and an Interaction Direction Validation
 	 *
 	 * @param OutInteractionComponent - Out Interaction Component If Found
+	 * @param OutItem - Out Interaction Item Index, @see UInteractionComponent::ResolveInteractionItem
 	 * @returns True If Interaction Exists and has Valid Direction
+	 * @note Does Not Change the Interaction Candidate or Item
 	 */
-	UFUNCTION()
-		FORCEINLINE bool TryGetInteraction(UInteractionComponent*& OutInteractionComponent)
+	bool TryGetInteraction(UInteractionComponent*& OutInteractionComponent, int32& OutItem);
+
+	/**
+	 * Returns the Current Interaction Candidate, Resolved Through the Candidate Focus
+	 */
+	UFUNCTION(BlueprintPure, Category = Interactor)
+		UInteractionComponent* GetInteractionCandidate() const;
+
+	/**
+	 * Returns the Handle of the Focus on the Interaction Candidate, Invalid Without a Candidate
+	 */
+	FORCEINLINE FInteractionHandle GetCandidateFocus() const
+	{
+		return CandidateFocus;
+	}
+
+	/**
+	 * Returns the Handle of the Interaction Session In Progress, Invalid If Not Interacting
+	 */
+	FORCEINLINE FInteractionHandle GetInteractionSession() const
 	{
-		OutInteractionComponent = GetInteractionTrace();
-		return ValidateDirection(OutInteractionComponent);
+		return InteractionSession;
+	}
+
+	/**
+	 * Returns the Identifier Used to Match this Interactor Across Seamless Travel and Server Migration
+	 *
+	 * @returns Unique Net Id of the Owning Player, Path Name of Level Placed Interactors, Empty Otherwise
+	 */
+	FString GetPersistentId() const;
+
+	/**
+	 * Resumes an Interaction Restored From a Snapshot on Authority, @see UInteractionSubsystem::RestoreSnapshot
+	 *
+	 * @param InteractionComponent - Interaction to Resume
+	 * @param Item - Item Index of the Interaction
+	 * @param ElapsedTime - Seconds the Interaction Was Already In Progress
+	 * @returns True If the Interaction Resumed
+	 */
+	bool ResumeInteraction(UInteractionComponent* InteractionComponent, int32 Item, float ElapsedTime);
+
+	/**
+	 * Returns the Item Index of the Interaction Candidate, INDEX_NONE If the Candidate is a Single Interactable
+	 */
+	UFUNCTION(BlueprintPure, Category = Interactor)
+		FORCEINLINE int32 GetInteractionItem() const
+	{
+		return InteractionItem;
 	}
 
 
@@ -184,27 +356,101 @@ protected:
 		bool bInteracting;
 
 	/**
-	 * Currently Interacting Interaction Component
+	 * Focus on the Currently Interacting Interaction Component, @see GetInteractionCandidate
+	 * @note A Handle Into the Focus Table of the Interaction Subsystem, Stale Once the Interaction is Gone
+	 */
+	FInteractionHandle CandidateFocus;
+
+	/**
+	 * Ends the Focus on the Current Candidate and Begins One on the New Candidate
+	 *
+	 * @param NewCandidate - Interaction to Focus, Null to Clear the Candidate
+	 */
+	void SetInteractionCandidate(UInteractionComponent* NewCandidate);
+
+	/**
+	 * Returns the Interaction Subsystem of the World Owning the Sessions and Focuses
+	 */
+	UInteractionSubsystem* GetInteractionSubsystem() const;
+
+	/**
+	 * Session of the Interaction In Progress, Authority Only
+	 */
+	FInteractionHandle InteractionSession;
+
+	/**
+	 * Item Index of the Interaction Candidate
 	 */
 	UPROPERTY(BlueprintReadOnly)
-		UInteractionComponent* InteractionCandidate;
+		int32 InteractionItem;
+
+	/**
+	 * Item Index Resolved by the Last Interaction Trace
+	 */
+	int32 TraceItem;
+
+	/**
+	 * Server Start Time and Duration of the Hold Interaction In Progress
+	 * @note Only Replicated If the Interactor or the Interaction Net Mode is All, Otherwise Sent to the Owner, @see Client_SetHoldProgress
+	 */
+	UPROPERTY(Replicated)
+		FInteractionHoldProgress HoldProgress;
+
+	/**
+	 * Sets the Hold Progress and Marks it Dirty for Replication
+	 */
+	void SetHoldProgress(const FInteractionHoldProgress& NewHoldProgress);
+
+	/**
+	 * Returns True If the Hold Progress is Replicated Based on the Interactor and Interaction Net Modes
+	 */
+	bool ReplicatesHoldProgress() const;
+
+	/**
+	 * Returns the Server World Time, Estimated on Clients
+	 */
+	float GetServerWorldTime() const;
+
+	/**
+	 * Boolean to Determine Whether the Interactor is Waiting in the Queue of the Interaction Candidate
+	 * @note Authority Only, Clients are Notified Through the Queued Interaction Result
+	 */
+	UPROPERTY()
+		bool bInteractionQueued;
 
 	// Called when the game starts
 	virtual void BeginPlay() override;
 
 	/**
 	 * Traces From the Eye Point of View
+	 * @note The Resolved Interaction Item is Stored in TraceItem
 	 *
 	 * @returns Returns the Interactable Components
 	 */
 	UFUNCTION()
 		UInteractionComponent* GetInteractionTrace();
 
+	/**
+	 * Returns the Cached Trace Result If Still Coherent With the View Point, Otherwise Traces
+	 * @note Used by the Tick, Requests are Always Validated With a Full Trace
+	 */
+	UInteractionComponent* GetCoherentInteractionTrace();
+
+	/**
+	 * Returns True If the Cached Trace Result Can be Reused From the Given View Point
+	 */
+	bool IsTraceCacheCoherent(const FVector& ViewLocation, const FRotator& ViewRotation, float CurrentTime) const;
+
+	/**
+	 * Result of the Last Full Trace
+	 */
+	FInteractionTraceCache TraceCache;
+
 	/**
 	 * Validates the Direction Towards Interaction Component
 	 */
 	UFUNCTION()
-		bool ValidateDirection(const UInteractionComponent* InteractionComponent) const;
+		bool ValidateDirection(const UInteractionComponent* InteractionComponent, int32 Item = -1) const;
 
 protected:
 
@@ -212,9 +458,16 @@ protected:
 	/**
 	 * Starts The Interaction With the Interaction Component
 	 * @note Should Not Be Called Directly, @see TryStartInteraction
+	 *
+	 * @param ElapsedTime - Seconds the Interaction Was Already In Progress, Non Zero When Resumed
 	 */
 	UFUNCTION()
-		void StartInteraction();
+		void StartInteraction(float ElapsedTime = 0.0f);
+
+	/**
+	 * Ends the Interaction Session In Progress, If Any
+	 */
+	void EndInteractionSession();
 
 	/**
 	 * Starts The Interactor Timer for a Given Duration
@@ -240,15 +493,7 @@ protected:
 	 * Sets bInteracting Value and Calls Related On Rep
 	 */
 	UFUNCTION()
-		void SetInteracting(bool bNewInteracting) 
-	{
-		bInteracting = bNewInteracting;
-
-		if (GetNetMode() != ENetMode::NM_DedicatedServer)
-		{
-			OnRep_bInteracting();
-		}
-	};
+		void SetInteracting(bool bNewInteracting);
 
 private:
 
@@ -258,12 +503,26 @@ private:
 	UPROPERTY()
 		FTimerHandle InteractorTimer;
 
+	/**
+	 * Server Side Request Token Bucket of this Interactor
+	 */
+	FInteractionTokenBucket ServerRequestBucket;
+
+	/**
+	 * Consumes a Server Request Token From the Interactor and its Connection
+	 *
+	 * @returns True If the Request is Within the Rate Limits and Should be Processed
+	 */
+	bool ConsumeServerRequest();
+
 	/**
 	 * RPC to Server To Start the Interaction
+	 *
+	 * @param LatencySequence - Sequence of the Request When Measuring Latency, Zero If Not Measured
 	 */
 	UFUNCTION(Server, Reliable, WithValidation)
-		void Server_TryStartInteraction();
-		bool Server_TryStartInteraction_Validate() { return true; };
+		void Server_TryStartInteraction(uint8 LatencySequence);
+		bool Server_TryStartInteraction_Validate(uint8 LatencySequence) { return true; };
 
 	/**
 	 * RPC to Server To Stop the Interaction
@@ -271,14 +530,46 @@ private:
 	UFUNCTION(Server, Reliable, WithValidation)
 		void Server_TryStopInteraction();
 		bool Server_TryStopInteraction_Validate() { return true; };
+
+	/**
+	 * Reports the Round Trip Latency of a Start Request Measured on the Client
+	 *
+	 * @param LatencyMs - Milliseconds From the Request to the First Notification
+	 * @param LatencySequence - Sequence of the Measured Request, Samples of Requests the Server Did Not Answer are Discarded
+	 */
+	UFUNCTION(Server, Unreliable, WithValidation)
+		void Server_ReportInteractionLatency(uint16 LatencyMs, uint8 LatencySequence);
+		bool Server_ReportInteractionLatency_Validate(uint16 LatencyMs, uint8 LatencySequence) { return true; };
+
+	/**
+	 * Reports the Latency of the Pending Start Request When its First Notification Arrives
+	 */
+	void ReportRequestLatency();
+
+	/**
+	 * Client Time the Pending Start Request Was Sent, Zero If None
+	 */
+	double LatencyRequestTime;
+
+	/**
+	 * Sequence of the Last Measured Start Request
+	 * @note On the Server, Sequence of the Last Request Answered With a Notification, Zero Once its Sample is Recorded
+	 */
+	uint8 LatencyRequestSequence;
+
+	/**
+	 * Number of Notifications Sent by the Server, Used to Tell Whether a Request Was Answered
+	 */
+	uint32 NotificationCount;
 	
 	/**
 	 * Invoked When a New Interaction Component is Valid Candidate
 	 *
 	 * @param NewInteraction - New Interaction Component
+	 * @param NewItem - Item Index of the New Interaction
 	 */
 	UFUNCTION()
-		void RegisterNewInteraction(UInteractionComponent* NewInteraction);
+		void RegisterNewInteraction(UInteractionComponent* NewInteraction, int32 NewItem = -1);
 
 	/**
 	 * Invoked When Interaction is Not Valid for Candidate
@@ -318,13 +609,63 @@ private:
 		void Client_NotifyInteraction(EInteractionResult NewInteractionResult, EInteractionType NewInteractionType);
 
 	/**
-	 * Multi Cast Call to all Clients Notifying Interaction State
+	 * Reliable Interaction State Notification of the Owner When Notifying All
 	 *
 	 * @param InteractionResult - Result of the Interaction
 	 * @param InteractionType - Type of Interaction
 	 */
+	UFUNCTION(Client, Reliable)
+		void Client_NotifyOwnerInteraction(EInteractionResult NewInteractionResult, EInteractionType NewInteractionType);
+
+	/**
+	 * Sends the Hold Progress to the Owner When it is Not Replicated
+	 *
+	 * @param NewHoldProgress - Server Start Time and Duration of the Hold Interaction
+	 */
+	UFUNCTION(Client, Reliable)
+		void Client_SetHoldProgress(const FInteractionHoldProgress& NewHoldProgress);
+
+	/**
+	 * Unreliable Multi Cast Call to Observers Notifying Intermediate Interaction State, Ignored by the Owner
+	 *
+	 * @param InteractionResult - Result of the Interaction
+	 * @param InteractionType - Type of Interaction
+	 * @param Sequence - Observer Sequence, Stale Notifications are Discarded
+	 */
+	UFUNCTION(NetMulticast, Unreliable)
+		void Multi_NotifyInteraction(EInteractionResult NewInteractionResult, EInteractionType NewInteractionType, uint8 Sequence);
+
+	/**
+	 * Reliable Multi Cast Call to Observers Notifying the Terminal Interaction State, Ignored by the Owner
+	 *
+	 * @param InteractionResult - Result of the Interaction
+	 * @param InteractionType - Type of Interaction
+	 * @param Sequence - Observer Sequence, Stale Notifications are Discarded
+	 */
 	UFUNCTION(NetMulticast, Reliable)
-		void Multi_NotifyInteraction(EInteractionResult NewInteractionResult, EInteractionType NewInteractionType);
+		void Multi_NotifyInteractionResult(EInteractionResult NewInteractionResult, EInteractionType NewInteractionType, uint8 Sequence);
+
+	/**
+	 * Forwards an Owner Notification to the Interaction Candidate
+	 * Interactions Notify the Interactor Owner Through the Reliable Interactor Notification
+	 */
+	void ForwardInteractionNotification(EInteractionResult NewInteractionResult);
+
+	/**
+	 * Broadcasts the Interactor State Locally
+	 */
+	void BroadcastInteractorState(EInteractionResult NewInteractionResult, EInteractionType NewInteractionType);
+
+	/**
+	 * Returns True If Owner Notifications of this Interactor Execute on this Machine
+	 * True for the Owning Client, a Listen Server Host and Server Owned Interactors
+	 */
+	bool ReceivesOwnerNotifications() const;
+
+	/**
+	 * Sequence of Observer Notifications
+	 */
+	FInteractionNotificationSequence ObserverSequence;
 
 
 
@@ -332,4 +673,53 @@ private:
 public:	
 	// Called every frame
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;		
+
+	/**
+	 * Returns True If an Interaction In Progress or Queued Needs to be Validated Every Frame
+	 */
+	FORCEINLINE bool NeedsInteractionValidation() const
+	{
+		return bInteracting || bInteractionQueued;
+	}
+
+	/**
+	 * Traces and Validates the Interaction In Progress Against the Current View Point
+	 * @note Safe to Run on Worker Threads, Only Reads the World and Writes this Interactor's Trace State
+	 *
+	 * @returns True If the Interaction Candidate is Still Valid
+	 */
+	bool ValidateInteractionInProgress();
+
+	/**
+	 * Handles a Notification Received in a Batch, @see AInteractionNotificationBatch
+	 *
+	 * @param bObserver - Whether it Was Sent as an Observer Notification
+	 */
+	void ReceiveNotification(EInteractionResult NewInteractionResult, EInteractionType NewInteractionType, bool bObserver);
+
+	/**
+	 * Returns True If this Machine Receives the Reliable Owner Notifications of this Interactor
+	 * Interactions Skip their Observer Notifications Here, @see ForwardInteractionNotification
+	 */
+	bool ReceivesOwnerInteractionState() const;
+
+	/**
+	 * Accepts an Observer Notification, Rejecting it on the Owner and When Stale
+	 *
+	 * @param Sequence - Observer Sequence of the Notification
+	 */
+	bool AcceptObserverNotification(uint8 Sequence);
+
+	/**
+	 * Applies the Result of a Validation, Ending the Interaction If No Longer Valid
+	 * @note Game Thread Only
+	 */
+	void ApplyInteractionValidation(bool bValid);
+
+private:
+
+	/**
+	 * Boolean Set While the Interaction Subsystem Validates this Interactor in its Parallel Server Update
+	 */
+	bool bParallelServerUpdate;
 };
@@ -0,0 +1,107 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Info.h"
+#include "InteractionDataTypes.h"
+#include "InteractionNotificationBatch.generated.h"
+
+class UActorComponent;
+class UInteractorComponent;
+
+/**
+ * Flags of a Batched Interaction Notification
+ */
+enum EInteractionNotificationFlags : uint8
+{
+	/** Delivered as the Group Notification of an Interaction Component */
+	INF_Group = 1 << 0,
+
+	/** A Started Notification Collapsed Into this Terminal Notification, Delivered First on Receipt */
+	INF_Started = 1 << 1,
+
+	/** Observer Notification, Discarded on Receipt If its Sequence is Stale */
+	INF_Observer = 1 << 2
+};
+
+/**
+ * Single Notification of a Batch
+ */
+USTRUCT()
+struct FInteractionNotification
+{
+	GENERATED_BODY()
+
+	/** Interactor or Interaction Component Receiving the Notification */
+	UPROPERTY()
+		UActorComponent* Component;
+
+	/** Interactor of Interaction Component Notifications */
+	UPROPERTY()
+		UInteractorComponent* Interactor;
+
+	UPROPERTY()
+		EInteractionResult Result;
+
+	UPROPERTY()
+		EInteractionType InteractionType;
+
+	/** @see EInteractionNotificationFlags */
+	UPROPERTY()
+		uint8 Flags;
+
+	/** Observer Sequence of the Component, @see FInteractionNotificationSequence */
+	UPROPERTY()
+		uint8 Sequence;
+
+	FInteractionNotification()
+		:Component(nullptr)
+		,Interactor(nullptr)
+		,Result(EInteractionResult::IR_None)
+		,InteractionType(EInteractionType::IT_None)
+		,Flags(0)
+		,Sequence(0)
+	{}
+
+	/**
+	 * Delivers the Notification to its Component
+	 */
+	void Deliver() const;
+};
+
+/**
+ * Owner Only Actor Carrying the Batched Interaction Notifications of a Single Connection
+ * Spawned by the Interaction Subsystem for Each Connection Receiving Batched Notifications
+ */
+UCLASS(NotPlaceable, Transient)
+class INTERACTIONPLUGIN_API AInteractionNotificationBatch : public AInfo
+{
+	GENERATED_BODY()
+
+public:
+
+	AInteractionNotificationBatch();
+
+	/**
+	 * Maximum Notifications per Observer Batch so Each Batch Fits a Single Packet
+	 */
+	static constexpr int32 MaxObserverNotifications = 32;
+
+	/**
+	 * Delivers the Owner and Terminal Observer Notifications Queued for this Connection During a Server Frame
+	 *
+	 * @param Notifications - Notifications in Queued Order
+	 */
+	UFUNCTION(Client, Reliable)
+		void Client_ReceiveNotifications(const TArray<FInteractionNotification>& Notifications);
+
+	/**
+	 * Delivers the Intermediate Observer Notifications Queued for this Connection During a Server Frame
+	 * @note Unreliable, Stale Notifications are Discarded by Sequence
+	 *
+	 * @param Notifications - Notifications in Queued Order
+	 */
+	UFUNCTION(Client, Unreliable)
+		void Client_ReceiveObserverNotifications(const TArray<FInteractionNotification>& Notifications);
+};
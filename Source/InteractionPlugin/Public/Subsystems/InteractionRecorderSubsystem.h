@@ -0,0 +1,323 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "InteractionDataTypes.h"
+#include "InteractionRecorderSubsystem.generated.h"
+
+class UInteractorComponent;
+class UInteractionComponent;
+
+/**
+ * Type of a Recorded Interaction Traffic Event
+ */
+enum class EInteractionTrafficEvent : uint8
+{
+	ITE_DefineInteractor,
+	ITE_DefineTarget,
+	ITE_TryStart,
+	ITE_TryStop,
+	ITE_HoldCompleted,
+	ITE_Notify
+};
+
+/**
+ * Single Event of a Recorded Interaction Traffic Stream
+ */
+struct FInteractionTrafficEvent
+{
+	/** Type of the Event */
+	EInteractionTrafficEvent Type;
+
+	/** Seconds Since the Recording Started */
+	float Time;
+
+	/** Recording Local Id of the Interactor */
+	uint32 InteractorId;
+
+	/** Recording Local Id of the Interaction, Zero If None */
+	uint32 TargetId;
+
+	/** View Location of the Interactor for Requests */
+	FVector ViewLocation;
+
+	/** View Rotation of the Interactor for Requests */
+	FRotator ViewRotation;
+
+	/** Reach Length for Interactor Definitions */
+	float ReachLength;
+
+	/** Interaction Result and Type for Notifications */
+	EInteractionResult Result;
+	EInteractionType InteractionType;
+
+	/** Name of Defined Interactors and Targets */
+	FString Name;
+
+	FInteractionTrafficEvent()
+		:Type(EInteractionTrafficEvent::ITE_TryStart)
+		,Time(0.0f)
+		,InteractorId(0)
+		,TargetId(0)
+		,ViewLocation(FVector::ZeroVector)
+		,ViewRotation(FRotator::ZeroRotator)
+		,ReachLength(0.0f)
+		,Result(EInteractionResult::IR_None)
+		,InteractionType(EInteractionType::IT_None)
+	{}
+
+	/**
+	 * Serializes the Event in the Compact Stream Format
+	 */
+	friend FArchive& operator<<(FArchive& Ar, FInteractionTrafficEvent& Event);
+};
+
+/**
+ * Records Server Side Interaction Traffic to a Compact Binary Stream and Replays it Into a Server World
+ * Replays Check the Targets of Replayed Requests and the Hold Completions and Notifications they Produce
+ * Against the Recorded Ones, Reporting Every Divergence
+ *
+ * Console Commands:
+ * Interaction.Record.Start [File]			: Starts Recording, Saved/Interaction/Traffic.irec If No File is Given
+ * Interaction.Record.Stop					: Stops Recording and Closes the Stream
+ * Interaction.Replay.Start <File> [Speed]	: Replays a Stream at the Given Speed Multiplier
+ * Interaction.Replay.Stop					: Stops the Replay, Reports Unmatched Outcomes and Destroys the Replay Interactors
+ */
+UCLASS()
+class INTERACTIONPLUGIN_API UInteractionRecorderSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UInteractionRecorderSubsystem();
+
+	/**
+	 * Closes the Recording Stream and Stops the Replay
+	 */
+	void Deinitialize() override;
+
+	/** FTickableGameObject Implementation */
+	void Tick(float DeltaTime) override;
+	ETickableTickType GetTickableTickType() const override;
+	bool IsTickable() const override;
+	TStatId GetStatId() const override;
+	UWorld* GetTickableGameObjectWorld() const override;
+
+	/**
+	 * Returns the Recorder of the World If it is Recording or Checking a Replay, Used by Hooks to Skip All Work Otherwise
+	 */
+	static UInteractionRecorderSubsystem* GetActiveRecorder(const UObject* WorldContextObject);
+
+	/**
+	 * Starts Recording to a File, Stopping Any Recording In Progress
+	 *
+	 * @returns True If the File Was Opened
+	 */
+	bool StartRecording(const FString& FileName);
+
+	/**
+	 * Stops Recording and Closes the Stream
+	 */
+	void StopRecording();
+
+	/**
+	 * Returns True If Recording
+	 */
+	FORCEINLINE bool IsRecording() const
+	{
+		return RecordingWriter != nullptr;
+	}
+
+	/**
+	 * Records a Start or Stop Request Received by an Authority Interactor
+	 *
+	 * @param TargetComponent - Interaction the Request Was Resolved Against, Null If None
+	 */
+	void RecordRequest(UInteractorComponent* InteractorComponent, UInteractionComponent* TargetComponent, bool bStart);
+
+	/**
+	 * Records the Completion of a Hold Interaction
+	 */
+	void RecordHoldCompleted(UInteractorComponent* InteractorComponent, UInteractionComponent* InteractionComponent);
+
+	/**
+	 * Records a Notification Sent by an Authority Interactor
+	 */
+	void RecordNotification(UInteractorComponent* InteractorComponent, EInteractionResult Result, EInteractionType InteractionType);
+
+	/**
+	 * Loads a Stream and Starts Feeding its Requests Into this World
+	 *
+	 * @param FileName - Recorded Stream
+	 * @param Speed - Replay Speed Multiplier
+	 * @returns True If the Stream Was Loaded
+	 */
+	bool StartReplay(const FString& FileName, float Speed = 1.0f);
+
+	/**
+	 * Stops the Replay, Reports Outcomes Left Unmatched and Destroys the Replay Interactors
+	 */
+	void StopReplay();
+
+	/**
+	 * Returns the Number of Divergences From the Recording Found by the Current or Last Replay
+	 */
+	FORCEINLINE int32 GetReplayDivergences() const
+	{
+		return ReplayDivergences;
+	}
+
+	/**
+	 * Returns True If Replaying
+	 */
+	FORCEINLINE bool IsReplaying() const
+	{
+		return ReplayEvents.Num() > 0;
+	}
+
+private:
+
+	/**
+	 * Writes an Event to the Recording Stream
+	 */
+	void WriteEvent(FInteractionTrafficEvent& Event);
+
+	/**
+	 * Returns the Recording Id of an Interactor, Defining it On First Use
+	 */
+	uint32 GetInteractorId(UInteractorComponent* InteractorComponent);
+
+	/**
+	 * Returns the Recording Id of an Interaction, Defining it On First Use
+	 */
+	uint32 GetTargetId(UInteractionComponent* InteractionComponent);
+
+	/**
+	 * Returns the Path of an Interaction Without the Play In Editor Prefix, Empty If None
+	 */
+	static FString GetTargetPath(const UInteractionComponent* InteractionComponent);
+
+	/**
+	 * Returns the Seconds Since the Recording Started
+	 */
+	float GetRecordingTime() const;
+
+	/**
+	 * Returns the Replay Interactor of a Recorded Id, Spawning it On First Use
+	 */
+	UInteractorComponent* GetReplayInteractor(uint32 InteractorId);
+
+	/**
+	 * Applies a Replayed Event to this World
+	 */
+	void ApplyReplayEvent(const FInteractionTrafficEvent& Event);
+
+	/**
+	 * Returns True While Replay Interactors Exist and their Outcomes are Checked
+	 */
+	FORCEINLINE bool IsReplayActive() const
+	{
+		return ReplayInteractors.Num() > 0;
+	}
+
+	/**
+	 * Returns the Recorded Id of a Replay Interactor, Zero If the Interactor is Not Replaying
+	 */
+	uint32 FindReplayInteractorId(const UInteractorComponent* InteractorComponent) const;
+
+	/**
+	 * Queues a Recorded or a Replayed Outcome and Matches the Queued Outcomes of the Interactor in Order
+	 */
+	void AddReplayOutcome(const FInteractionTrafficEvent& Outcome, bool bRecorded);
+
+	/**
+	 * Compares a Recorded Outcome to the Replayed One
+	 */
+	void CompareReplayOutcomes(const FInteractionTrafficEvent& Recorded, const FInteractionTrafficEvent& Replayed);
+
+	/**
+	 * Logs and Counts a Divergence of the Replay From the Recording
+	 */
+	void ReportReplayDivergence(uint32 InteractorId, const FString& Description);
+
+	/**
+	 * Stream the Recording is Written To
+	 */
+	FArchive* RecordingWriter;
+
+	/**
+	 * World Time the Recording Started
+	 */
+	float RecordingStartTime;
+
+	/**
+	 * Recording Ids of the Recorded Interactors
+	 */
+	TMap<TWeakObjectPtr<UInteractorComponent>, uint32> InteractorIds;
+
+	/**
+	 * Recording Ids of the Recorded Interactions by Path Name
+	 */
+	TMap<FString, uint32> TargetIds;
+
+	/**
+	 * Events of the Stream Being Replayed
+	 */
+	TArray<FInteractionTrafficEvent> ReplayEvents;
+
+	/**
+	 * Index of the Next Event to Replay
+	 */
+	int32 ReplayIndex;
+
+	/**
+	 * Elapsed Replay Time in Recorded Seconds
+	 */
+	float ReplayTime;
+
+	/**
+	 * Replay Speed Multiplier
+	 */
+	float ReplaySpeed;
+
+	/**
+	 * Reach Length of Each Recorded Interactor
+	 */
+	TMap<uint32, float> ReplayReachLengths;
+
+	/**
+	 * Path of Each Recorded Interaction by Recording Id
+	 */
+	TMap<uint32, FString> ReplayTargetPaths;
+
+	/**
+	 * Recorded Ids of the Replay Interactors
+	 */
+	TMap<const UInteractorComponent*, uint32> ReplayInteractorIds;
+
+	/**
+	 * Recorded and Replayed Outcomes per Interactor Waiting to be Matched
+	 */
+	TMap<uint32, TArray<FInteractionTrafficEvent>> RecordedOutcomes;
+	TMap<uint32, TArray<FInteractionTrafficEvent>> ReplayedOutcomes;
+
+	/**
+	 * Request Event Being Applied, Checked Against the Target the Replayed Request Resolves
+	 */
+	const FInteractionTrafficEvent* ApplyingEvent;
+
+	/**
+	 * Number of Divergences Found by the Replay
+	 */
+	int32 ReplayDivergences;
+
+	/**
+	 * Interactors Spawned to Replay Recorded Interactors
+	 */
+	UPROPERTY(Transient)
+		TMap<uint32, UInteractorComponent*> ReplayInteractors;
+};
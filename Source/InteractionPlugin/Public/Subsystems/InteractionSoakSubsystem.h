@@ -0,0 +1,306 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Tickable.h"
+#include "InteractionDataTypes.h"
+#include "InteractionSoakSubsystem.generated.h"
+
+class UInteractorComponent;
+class UNetConnection;
+struct FOutParmRec;
+struct FFrame;
+
+/**
+ * Metrics Gathered by the Server During a Soak Run
+ */
+USTRUCT(BlueprintType)
+struct FInteractionSoakReport
+{
+	GENERATED_BODY()
+
+	/** Duration of the Run in Seconds */
+	UPROPERTY(BlueprintReadOnly, Category = Interaction)
+		float Duration;
+
+	/** Average Server Game Thread Work per Frame in Milliseconds, Excluding Idle Time */
+	UPROPERTY(BlueprintReadOnly, Category = Interaction)
+		float AverageFrameMs;
+
+	/** Worst Server Game Thread Work per Frame in Milliseconds */
+	UPROPERTY(BlueprintReadOnly, Category = Interaction)
+		float MaxFrameMs;
+
+	/** Payload Bytes of Interaction RPCs and Replicated Interaction Properties Sent by the Server per Started Interaction */
+	UPROPERTY(BlueprintReadOnly, Category = Interaction)
+		float BytesPerInteraction;
+
+	/** Highest Number of Client Connections During the Run */
+	UPROPERTY(BlueprintReadOnly, Category = Interaction)
+		int32 PeakConnections;
+
+	/** Highest Number of Unacknowledged Reliable Bunches of Any Channel */
+	UPROPERTY(BlueprintReadOnly, Category = Interaction)
+		int32 ReliableBufferHighWater;
+
+	/** Started, Failed and Interrupted Interactions */
+	UPROPERTY(BlueprintReadOnly, Category = Interaction)
+		int32 StartedCount;
+
+	UPROPERTY(BlueprintReadOnly, Category = Interaction)
+		int32 FailedCount;
+
+	UPROPERTY(BlueprintReadOnly, Category = Interaction)
+		int32 InterruptedCount;
+
+	/** Failed Interactions Over All Attempts */
+	UPROPERTY(BlueprintReadOnly, Category = Interaction)
+		float FailureRate;
+
+	FInteractionSoakReport()
+		:Duration(0.0f)
+		,AverageFrameMs(0.0f)
+		,MaxFrameMs(0.0f)
+		,BytesPerInteraction(0.0f)
+		,PeakConnections(0)
+		,ReliableBufferHighWater(0)
+		,StartedCount(0)
+		,FailedCount(0)
+		,InterruptedCount(0)
+		,FailureRate(0.0f)
+	{}
+};
+
+/**
+ * Soak Harness Driving Randomised Interaction Traffic Over Real Connections
+ *
+ * Run a Dedicated Server With -InteractionSoak=<Seconds> -InteractionSoakClients=<N> to Launch N Headless Clients Over Localhost,
+ * Each Driving -InteractionSoakPlayers=<P> Split Screen Interactors. Clients Issue Random Start/Stop Requests,
+ * the Server Gathers Metrics and Checks them Against the Configured Budgets
+ *
+ * Console Commands:
+ * Interaction.Soak.Start [Seconds] [PktLoss] [PktLag]	: Starts a Soak Run in this World
+ * Interaction.Soak.Stop									: Ends the Run and Reports
+ */
+UCLASS(config = Game)
+class INTERACTIONPLUGIN_API UInteractionSoakSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UInteractionSoakSubsystem();
+
+	/**
+	 * Starts a Soak Run If Requested on the Command Line
+	 */
+	void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	/** FTickableGameObject Implementation */
+	void Tick(float DeltaTime) override;
+	ETickableTickType GetTickableTickType() const override;
+	bool IsTickable() const override;
+	TStatId GetStatId() const override;
+	UWorld* GetTickableGameObjectWorld() const override;
+
+	/**
+	 * [Config] Start/Stop Requests per Second Issued by Each Simulated Client
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Soak")
+		float RequestsPerSecond;
+
+	/**
+	 * [Config] Maximum Seconds a Simulated Client Holds an Interaction Before Stopping
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Soak")
+		float MaxHoldTime;
+
+	/**
+	 * [Config] Maximum Random Yaw Change in Degrees Applied Before Each Request
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Soak")
+		float ViewJitter;
+
+	/**
+	 * [Config] Minimum Client Connections a Run Must Reach to Pass, Raised to the Number of Launched Clients
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Soak", meta = (ClampMin = "1"))
+		int32 MinConnections;
+
+	/**
+	 * [Config] Budgets Checked at the End of a Run, Zero or Less Disables a Budget
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Soak")
+		float MaxAverageFrameMs;
+
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Soak")
+		float MaxBytesPerInteraction;
+
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Soak")
+		int32 MaxReliableBuffer;
+
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Soak")
+		float MaxFailureRate;
+
+	/**
+	 * Returns the Soak Subsystem of the World If a Run is Active, Used by Hooks to Skip All Work Otherwise
+	 */
+	static UInteractionSoakSubsystem* GetActiveSoak(const UObject* WorldContextObject);
+
+	/**
+	 * Starts a Soak Run
+	 *
+	 * @param Duration - Seconds Before the Run Ends, Zero or Less Runs Until Stopped
+	 * @param PacketLoss - Simulated Packet Loss Percentage
+	 * @param PacketLag - Simulated Packet Lag in Milliseconds
+	 */
+	void StartSoak(float Duration, int32 PacketLoss = 0, int32 PacketLag = 0);
+
+	/**
+	 * Ends the Run, Reports the Metrics and Checks the Budgets on the Server
+	 *
+	 * @returns True If Every Budget Was Met
+	 */
+	bool StopSoak();
+
+	/**
+	 * Returns True If a Run is Active
+	 */
+	FORCEINLINE bool IsSoaking() const
+	{
+		return bSoaking;
+	}
+
+	/**
+	 * Counts a Notification Sent by an Authority Interactor
+	 */
+	void RecordNotification(EInteractionResult Result);
+
+	/**
+	 * Counts the Payload of a Replicated Interaction Property Marked Dirty, Once per Connection the Owner Replicates To
+	 */
+	static void CountPropertyBytes(const UObject* Object, FName PropertyName);
+
+	/**
+	 * Counts the Payload of a Changed Fast Array Item of an Interaction Class, Once per Connection the Owner Replicates To
+	 */
+	static void CountItemBytes(const UObject* Object, const UScriptStruct* ItemStruct, const void* ItemData);
+
+	/**
+	 * Returns the Metrics of the Current or Last Run
+	 */
+	UFUNCTION(BlueprintPure, Category = Interaction)
+		const FInteractionSoakReport& GetSoakReport() const
+	{
+		return Report;
+	}
+
+private:
+
+	/**
+	 * Issues Random Requests From the Interactors of Every Local Player
+	 */
+	void DriveLocalInteractors(float DeltaTime);
+
+	/**
+	 * Issues a Random Request From a Single Interactor
+	 */
+	void DriveInteractor(APlayerController* PlayerController, UInteractorComponent* InteractorComponent, float DeltaTime);
+
+	/**
+	 * Adds Split Screen Players Until the Requested Number of Local Interactors Exists
+	 */
+	void CreateLocalPlayers();
+
+	/**
+	 * Launches the Requested Headless Client Processes Connecting to this Server
+	 */
+	void LaunchClients(float Duration, int32 PacketLoss, int32 PacketLag);
+
+	/**
+	 * Terminates the Launched Clients Still Running and Releases their Handles
+	 */
+	void ReleaseClients();
+
+	/**
+	 * Samples Frame Time and Reliable Buffer Usage on the Server
+	 */
+	void SampleServerMetrics(float DeltaTime);
+
+	/**
+	 * Counts the Payload of Interaction RPCs Sent by the Server
+	 */
+	void OnSendRPC(AActor* Actor, UFunction* Function, void* Parameters, FOutParmRec* OutParms, FFrame* Stack, UObject* SubObject, bool& bBlockSendRPC);
+
+	/**
+	 * Adds Payload Bits Sent to Every Connection the Actor Replicates To, or Only to its Owner
+	 */
+	void AddInteractionBits(const AActor* Actor, int64 Bits, bool bOwnerOnly);
+
+	/**
+	 * Returns the Number of Client Connections With an Open Channel For an Actor
+	 */
+	int32 GetNumReplicatingConnections(const AActor* Actor) const;
+
+	/**
+	 * Boolean Set While a Run is Active
+	 */
+	bool bSoaking;
+
+	/**
+	 * Boolean to Exit With the Budget Result When the Run Ends
+	 */
+	bool bExitWhenDone;
+
+	/**
+	 * Seconds Before the Run Ends
+	 */
+	float SoakDuration;
+
+	/**
+	 * Seconds Since the Run Started
+	 */
+	float SoakTime;
+
+	/**
+	 * Seconds Until Each Local Interactor Stops its Interaction
+	 */
+	TMap<TWeakObjectPtr<UInteractorComponent>, float> StopCountdowns;
+
+	/**
+	 * Local Players Each Client Drives, Including the First One
+	 */
+	int32 LocalPlayerCount;
+
+	/**
+	 * Client Processes Launched by the Server
+	 */
+	TArray<FProcHandle> LaunchedClients;
+
+	/**
+	 * Boolean Set While the RPC Payload Counter is Bound to the Net Driver
+	 */
+	bool bCountingRPCs;
+
+	/**
+	 * Number of Frames Sampled by the Server
+	 */
+	int32 SampledFrames;
+
+	/**
+	 * Total Server Game Thread Work of the Sampled Frames
+	 */
+	double TotalFrameMs;
+
+	/**
+	 * Payload Bits of Interaction RPCs and Properties Sent During the Run
+	 */
+	int64 InteractionBitsSent;
+
+	/**
+	 * Metrics of the Current or Last Run
+	 */
+	FInteractionSoakReport Report;
+};
@@ -0,0 +1,694 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Engine/EngineTypes.h"
+#include "Engine/StreamableManager.h"
+#include "Tickable.h"
+#include "InteractionDataTypes.h"
+#include "InteractionLatency.h"
+#include "InteractionSession.h"
+#include "Index/InteractionTagIndex.h"
+#include "Replication/InteractionNotificationBatch.h"
+#include "InteractionSubsystem.generated.h"
+
+class UNetConnection;
+class UInteractionComponent;
+class UInteractorComponent;
+class UInteractionDefinition;
+
+/**
+ * Compact Persistent Record of an Interaction Whose Level is Streamed Out
+ */
+USTRUCT(BlueprintType)
+struct INTERACTIONPLUGIN_API FInteractionRecord
+{
+	GENERATED_BODY()
+
+	/** World Location of the Interaction */
+	UPROPERTY(BlueprintReadOnly, Category = Interaction)
+		FVector Location;
+
+	/** Definition of the Interaction */
+	UPROPERTY(BlueprintReadOnly, Category = Interaction)
+		TSoftObjectPtr<UInteractionDefinition> Definition;
+
+	/** Whether the Interaction Component Was Active */
+	UPROPERTY(BlueprintReadOnly, Category = Interaction)
+		bool bActive;
+
+	/** Interaction Type Specific State, E.g Consumed Instances */
+	UPROPERTY()
+		TArray<uint8> State;
+
+	FInteractionRecord()
+		:Location(FVector::ZeroVector)
+		,bActive(true)
+	{}
+
+	/**
+	 * Serializes the Record Into an Interaction Snapshot
+	 */
+	friend FArchive& operator<<(FArchive& Ar, FInteractionRecord& Record)
+	{
+		FString DefinitionPath = Record.Definition.ToString();
+
+		Ar << Record.Location << DefinitionPath << Record.bActive << Record.State;
+
+		if (Ar.IsLoading())
+		{
+			Record.Definition = TSoftObjectPtr<UInteractionDefinition>(FSoftObjectPath(DefinitionPath));
+		}
+
+		return Ar;
+	}
+};
+
+/**
+ * World Subsystem Holding Interaction State Shared Between Components
+ */
+UCLASS(config = Game)
+class INTERACTIONPLUGIN_API UInteractionSubsystem : public UWorldSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+
+	UInteractionSubsystem();
+
+	/**
+	 * Releases Shared Interaction State
+	 */
+	void Deinitialize() override;
+
+	/** FTickableGameObject Implementation */
+	void Tick(float DeltaTime) override;
+	ETickableTickType GetTickableTickType() const override;
+	bool IsTickable() const override;
+	TStatId GetStatId() const override;
+	UWorld* GetTickableGameObjectWorld() const override;
+
+	/**
+	 * [Config] Trace Channel Used by Interactors and Interaction Proxy Shapes
+	 * @note Define a Dedicated Channel in the Project Collision Settings, Defaults to Visibility
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Collision")
+		TEnumAsByte<ECollisionChannel> InteractionTraceChannel;
+
+	/**
+	 * Returns the Configured Interaction Trace Channel
+	 */
+	static ECollisionChannel GetInteractionTraceChannel()
+	{
+		return GetDefault<UInteractionSubsystem>()->InteractionTraceChannel;
+	}
+
+	/**
+	 * [Config] Boolean to Let Proxy Shapes Block the Visibility Channel When it is the Interaction Trace Channel
+	 * @note Proxies Blocking Visibility Also Block AI Sight, Cameras and Other Visibility Traces
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Collision")
+		bool bProxiesBlockVisibility;
+
+	/**
+	 * Returns True If Proxy Shapes May Block the Interaction Trace Channel
+	 */
+	static bool CanProxiesBlockTraceChannel()
+	{
+		const UInteractionSubsystem* Defaults = GetDefault<UInteractionSubsystem>();
+
+		return Defaults->InteractionTraceChannel != ECC_Visibility || Defaults->bProxiesBlockVisibility;
+	}
+
+	/**
+	 * Registers an Interaction Entering Play, Restoring its Persistent Record on Authority
+	 */
+	void RegisterInteraction(UInteractionComponent* InteractionComponent);
+
+	/**
+	 * Unregisters an Interaction Leaving Play or Returning to a Pool
+	 *
+	 * @param InteractionComponent - Interaction to Unregister
+	 * @param bStoreRecord - Whether to Store the Persistent Record, Used When its Level is Streamed Out
+	 */
+	void UnregisterInteraction(UInteractionComponent* InteractionComponent, bool bStoreRecord = false);
+
+	/**
+	 * Returns the Registered Interactions
+	 */
+	const TArray<UInteractionComponent*>& GetRegisteredInteractions() const
+	{
+		return RegisteredInteractions;
+	}
+
+	/**
+	 * Invokes the Callback For Each Registered Interaction Within a Radius
+	 *
+	 * @param Center - World Location
+	 * @param Radius - Radius of the Query
+	 */
+	void ForEachInteractionInRadius(const FVector& Center, float Radius, TFunctionRef<void(UInteractionComponent*)> Callback) const;
+
+	/**
+	 * [Config] Size in Units of the Grid Cells of the Tag Index
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Tags", meta = (ClampMin = 100.0f))
+		float TagIndexCellSize;
+
+	/**
+	 * Returns the Active Tagged Interactions Within a Radius Having All the Required Tags and None of the Blocked Tags
+	 * @note Only Interactions With Tags are Indexed, Cost Scales With the Interactions of the Visited Cells Passing the Tag Test
+	 *
+	 * @param Center - World Location
+	 * @param Radius - Radius of the Query
+	 * @param RequiredTags - Tags Every Result Has, Parent Tags Match their Children
+	 * @param BlockedTags - Tags No Result Has
+	 * @param OutInteractions - Matching Interactions
+	 */
+	UFUNCTION(BlueprintCallable, Category = Interaction)
+		void QueryInteractions(FVector Center, float Radius, const FGameplayTagContainer& RequiredTags, const FGameplayTagContainer& BlockedTags, TArray<UInteractionComponent*>& OutInteractions) const;
+
+	/**
+	 * Returns the Active Tagged Interaction Items Within a Radius, Interactions With Items Such as Instanced Ones are Returned per Matching Item
+	 *
+	 * @param OutInteractions - Interaction of Each Match
+	 * @param OutItems - Item of Each Match, INDEX_NONE For Interactions Without Items
+	 * @see QueryInteractions
+	 */
+	UFUNCTION(BlueprintCallable, Category = Interaction)
+		void QueryInteractionItems(FVector Center, float Radius, const FGameplayTagContainer& RequiredTags, const FGameplayTagContainer& BlockedTags, TArray<UInteractionComponent*>& OutInteractions, TArray<int32>& OutItems) const;
+
+	/**
+	 * Updates the Tags and Location of a Registered Interaction in the Tag Index
+	 */
+	void UpdateInteractionTags(UInteractionComponent* InteractionComponent);
+
+	/**
+	 * Updates the Location of an Indexed Interaction in the Tag Index After it Moved
+	 */
+	void UpdateInteractionLocation(UInteractionComponent* InteractionComponent);
+
+	/**
+	 * Returns the Persistent Records of Interactions Whose Levels are Streamed Out
+	 */
+	const TMap<FName, FInteractionRecord>& GetInteractionRecords() const
+	{
+		return InteractionRecords;
+	}
+
+	/**
+	 * Writes a Versioned Binary Snapshot of the Interaction Sessions and Persistent Interaction State
+	 * @note Authority Only, Take it Before Seamless Travel or Migration and Restore it in the New World
+	 *
+	 * @param OutData - Snapshot Data
+	 * @returns Number of Sessions Captured, INDEX_NONE on Clients
+	 */
+	int32 CaptureSnapshot(TArray<uint8>& OutData);
+
+	/**
+	 * Restores a Snapshot, Interaction State is Applied Now or When the Interaction Registers
+	 * Sessions are Resumed With Rebased Start Times Once Both Interactor and Interaction are In Play
+	 *
+	 * @param Data - Snapshot Data
+	 * @returns False If the Snapshot is Invalid or of Another Version
+	 */
+	bool RestoreSnapshot(const TArray<uint8>& Data);
+
+	/**
+	 * [Config] Seconds Restored Sessions Wait For their Interactor and Interaction to be In Play Before Being Dropped
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Snapshot", meta = (ClampMin = 0.0f))
+		float SnapshotResumeTimeout;
+
+	/**
+	 * [Config] Sustained Interaction Requests per Second Accepted From a Single Connection
+	 * @note Zero or Less Disables Connection Rate Limiting
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|RateLimit")
+		float ConnectionRequestRate;
+
+	/**
+	 * [Config] Maximum Burst of Interaction Requests Accepted From a Single Connection
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|RateLimit", meta = (ClampMin = 1.0f))
+		float ConnectionRequestBurst;
+
+	/**
+	 * Tries to Consume a Request Token From the Bucket of a Connection
+	 *
+	 * @param Connection - Connection the Request Was Received From, Null Connections are Never Limited
+	 * @returns True If the Request is Allowed
+	 */
+	bool ConsumeConnectionRequest(UNetConnection* Connection);
+
+	/**
+	 * Records the Outcome of a Rate Limited Server Request for Counters and Logging
+	 *
+	 * @param Connection - Connection the Request Was Received From
+	 * @param bAccepted - Whether the Request Was Accepted
+	 */
+	void RecordServerRequest(UNetConnection* Connection, bool bAccepted);
+
+	/**
+	 * Returns the Total Number of Accepted Interaction Server Requests
+	 */
+	UFUNCTION(BlueprintPure, Category = Interaction)
+		int32 GetAcceptedRequestCount() const
+	{
+		return AcceptedRequestCount;
+	}
+
+	/**
+	 * Returns the Total Number of Interaction Server Requests Dropped by Rate Limiting
+	 */
+	UFUNCTION(BlueprintPure, Category = Interaction)
+		int32 GetDroppedRequestCount() const
+	{
+		return DroppedRequestCount;
+	}
+
+	/**
+	 * [Config] Boolean to Validate Server Side Interactions In Progress on Worker Threads Instead of Each Interactor Tick
+	 * @note State Transitions are Still Applied Serially on the Game Thread
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Parallel")
+		bool bParallelServerUpdate;
+
+	/**
+	 * [Config] Minimum Number of Interactions In Progress to Dispatch the Validation to Worker Threads
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Parallel", meta = (ClampMin = 1, EditCondition = "bParallelServerUpdate"))
+		int32 MinParallelInteractors;
+
+	/**
+	 * [Config] Boolean to Queue Interaction Notifications per Connection and Send them as One Batch at the End of the Frame
+	 * @note Started Notifications Followed by a Terminal Result in the Same Frame are Collapsed Into One
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Batching")
+		bool bBatchNotifications;
+
+	/**
+	 * [Config] Maximum Number of Notifications Held per Connection While its Batch Can't be Sent
+	 * @note Held While the Connection Has No Player Controller or the Batch Channel is Opening, the Oldest are Dropped First
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Batching", meta = (ClampMin = 1, EditCondition = "bBatchNotifications"))
+		int32 MaxHeldNotifications;
+
+	/**
+	 * Returns the Interaction Subsystem If it Batches Notifications in this World, Null Otherwise
+	 */
+	static UInteractionSubsystem* GetNotificationBatcher(const UObject* WorldContextObject);
+
+	/**
+	 * Queues a Reliable Owner Interactor Notification for the Connection Owning the Interactor
+	 *
+	 * @param Flags - @see EInteractionNotificationFlags
+	 * @returns False If the Interactor Has No Remote Connection and Must be Notified Directly
+	 */
+	bool QueueOwnerNotification(UInteractorComponent* InteractorComponent, EInteractionResult Result, EInteractionType InteractionType, uint8 Flags = 0);
+
+	/**
+	 * Queues an Observer Notification for Every Connection the Component Owner is Replicated To
+	 * Terminal Results are Queued With the Reliable Owner Notifications, the Rest are Unreliable
+	 * @note The Caller Delivers the Notification Locally
+	 *
+	 * @param Component - Interactor or Interaction Component Notified
+	 * @param InteractorComponent - Interactor of Interaction Component Notifications
+	 * @param Flags - @see EInteractionNotificationFlags
+	 * @param Sequence - Observer Sequence of the Component
+	 * @param OwnerConnection - Connection Notified Through the Owner Tier Instead, Skipped
+	 */
+	void QueueMulticastNotification(UActorComponent* Component, UInteractorComponent* InteractorComponent, EInteractionResult Result, EInteractionType InteractionType, uint8 Flags, uint8 Sequence, UNetConnection* OwnerConnection = nullptr);
+
+	/**
+	 * [Config] Boolean to Asynchronously Prefetch the Feedback Assets of Interactions Near the Local Interactor
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Prefetch")
+		bool bPrefetchFeedbackAssets;
+
+	/**
+	 * [Config] Distance From the Local View Point Within Which Feedback Assets are Prefetched
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Prefetch", meta = (EditCondition = "bPrefetchFeedbackAssets"))
+		float PrefetchRadius;
+
+	/**
+	 * [Config] Distance Beyond Which Prefetched Assets are Released, Larger Than the Prefetch Radius to Avoid Thrashing
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Prefetch", meta = (EditCondition = "bPrefetchFeedbackAssets"))
+		float PrefetchReleaseRadius;
+
+	/**
+	 * [Config] Seconds Between Prefetch Updates
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Prefetch", meta = (EditCondition = "bPrefetchFeedbackAssets"))
+		float PrefetchInterval;
+
+	/**
+	 * Returns True If the Feedback Assets of an Interaction are Prefetched and Loaded
+	 */
+	bool AreFeedbackAssetsLoaded(const UInteractionComponent* InteractionComponent) const;
+
+	/**
+	 * [Config] Boolean to Measure Request Latency Into Global and per Connection Histograms
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Telemetry")
+		bool bLatencyTelemetry;
+
+	/**
+	 * [Config] Seconds Between Latency Dumps to Saved/Interaction, Zero or Less Disables Periodic Dumps
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Telemetry", meta = (EditCondition = "bLatencyTelemetry"))
+		float LatencyDumpInterval;
+
+	/**
+	 * [Config] Boolean to Write Periodic Latency Dumps as CSV Instead of JSON
+	 */
+	UPROPERTY(config, EditAnywhere, BlueprintReadOnly, Category = "Interaction|Telemetry", meta = (EditCondition = "bLatencyTelemetry"))
+		bool bLatencyDumpCsv;
+
+	/**
+	 * Returns True If Latency Telemetry is Enabled in the Config
+	 */
+	static bool IsLatencyTelemetryEnabled()
+	{
+		return GetDefault<UInteractionSubsystem>()->bLatencyTelemetry;
+	}
+
+	/**
+	 * Adds a Latency Sample to the Global and Connection Histograms of a Stage
+	 *
+	 * @param Stage - Stage of the Request Path
+	 * @param Connection - Connection of the Request, Only Global Histograms If Null
+	 * @param LatencyMs - Latency in Milliseconds
+	 */
+	void RecordLatency(EInteractionLatencyStage Stage, UNetConnection* Connection, float LatencyMs);
+
+	/**
+	 * Logs the Percentiles of the Global and Connection Histograms
+	 */
+	void LogLatency();
+
+	/**
+	 * Writes the Percentiles of the Global and Connection Histograms to Saved/Interaction
+	 *
+	 * @param bCsv - Whether to Write CSV Instead of JSON
+	 * @returns Path of the Written File
+	 */
+	FString DumpLatency(bool bCsv);
+
+	/**
+	 * Clears All Latency Histograms
+	 */
+	void ResetLatency();
+
+	/**
+	 * Adds an Authority Interactor to the Parallel Server Update
+	 */
+	void RegisterServerInteractor(UInteractorComponent* InteractorComponent);
+
+	/**
+	 * Removes an Authority Interactor From the Parallel Server Update
+	 */
+	void UnregisterServerInteractor(UInteractorComponent* InteractorComponent);
+
+	/**
+	 * Begins an Interaction Session
+	 *
+	 * @param ElapsedTime - Seconds the Session Was Already In Progress, Used When Resuming
+	 * @returns Handle Held by the Components of the Session
+	 */
+	FInteractionHandle BeginSession(UInteractorComponent* InteractorComponent, UInteractionComponent* InteractionComponent, float ElapsedTime = 0.0f);
+
+	/**
+	 * Ends an Interaction Session and Resets the Handle, Stale Handles are Ignored
+	 */
+	void EndSession(FInteractionHandle& Handle);
+
+	/**
+	 * Returns the Session of a Handle, Null If the Session Ended or Either Component is Gone
+	 */
+	FORCEINLINE const FInteractionSession* FindSession(FInteractionHandle Handle) const
+	{
+		return Sessions.FindAlive(Handle);
+	}
+
+	/**
+	 * Returns the Session Table
+	 */
+	FORCEINLINE const FInteractionSessionTable& GetSessions() const
+	{
+		return Sessions;
+	}
+
+	/**
+	 * Begins the Focus of an Interactor on its Interaction Candidate
+	 *
+	 * @returns Handle Held by the Interactor and the Focused Interaction
+	 */
+	FInteractionHandle BeginFocus(UInteractorComponent* InteractorComponent, UInteractionComponent* InteractionComponent);
+
+	/**
+	 * Ends a Focus and Resets the Handle, Stale Handles are Ignored
+	 */
+	void EndFocus(FInteractionHandle& Handle);
+
+	/**
+	 * Returns the Focus of a Handle, Null If the Focus Ended or Either Component is Gone
+	 */
+	FORCEINLINE const FInteractionSession* FindFocus(FInteractionHandle Handle) const
+	{
+		return Focuses.FindAlive(Handle);
+	}
+
+private:
+
+	/**
+	 * Interaction Sessions In Progress
+	 */
+	FInteractionSessionTable Sessions;
+
+	/**
+	 * Interactors Focusing their Interaction Candidate, Kept Apart From the Sessions In Progress
+	 */
+	FInteractionSessionTable Focuses;
+
+	/**
+	 * Ends the Sessions and Focuses Whose Interactor or Interaction is Gone
+	 */
+	void PruneSessions();
+
+	/**
+	 * Restored Sessions Waiting For their Interactor and Interaction
+	 */
+	TArray<FInteractionSessionSnapshot> PendingResumes;
+
+	/**
+	 * World Time Pending Resumes are Dropped At
+	 */
+	float PendingResumeExpireTime;
+
+	/**
+	 * Interaction of Each Pending Resume by Persistent Id, Unset Until it is In Play
+	 * @note Built Once per Restore and Filled as Interactions Register, Never Rebuilt per Tick
+	 */
+	TMap<FName, TWeakObjectPtr<UInteractionComponent>> PendingResumeInteractions;
+
+	/**
+	 * Levels of the Interactions of the Pending Resumes, Only their Interactions Compute a Persistent Id on Register
+	 */
+	TSet<FName> PendingResumeLevels;
+
+	/**
+	 * Sets the Pending Resume Entry of an Interaction In Play If a Pending Resume Expects it
+	 */
+	void AddPendingResumeInteraction(UInteractionComponent* InteractionComponent);
+
+	/**
+	 * Drops the Pending Resumes Lookup Once No Session is Waiting
+	 */
+	void ResetPendingResumes();
+
+	/**
+	 * Resumes the Pending Sessions Whose Interactor and Interaction are In Play
+	 */
+	void ResumePendingSessions();
+
+	/**
+	 * Invokes the Callback For Each Registered Interaction
+	 */
+	void ForEachInteraction(TFunctionRef<void(UInteractionComponent*)> Callback) const;
+
+	/**
+	 * Validates the Interactions In Progress of Server Interactors in Parallel and Applies the Results
+	 */
+	void UpdateServerInteractors();
+
+	/**
+	 * Authority Interactors Validated by the Parallel Server Update
+	 */
+	UPROPERTY()
+		TArray<UInteractorComponent*> ServerInteractors;
+
+	/**
+	 * Interactors With an Interaction In Progress Gathered for the Current Update
+	 */
+	UPROPERTY(Transient)
+		TArray<UInteractorComponent*> ActiveServerInteractors;
+
+	/**
+	 * Validation Output of Each Active Server Interactor, Written by Worker Threads
+	 */
+	TArray<bool> ServerInteractorResults;
+
+	/**
+	 * Registered Interactions in Contiguous Storage
+	 */
+	UPROPERTY()
+		TArray<UInteractionComponent*> RegisteredInteractions;
+
+	/**
+	 * Index of Each Registered Interaction in the Registry
+	 */
+	TMap<UInteractionComponent*, int32> RegistryIndices;
+
+	/**
+	 * Spatial Index of Tagged Interactions
+	 */
+	FInteractionTagIndex TagIndex;
+
+	/**
+	 * Persistent Records of Streamed Out Interactions by Persistent Id
+	 */
+	UPROPERTY()
+		TMap<FName, FInteractionRecord> InteractionRecords;
+
+	/**
+	 * Number of Persistent Records per Level Package
+	 * @note Interactions of Levels Without Records Never Build their Persistent Id When Registering
+	 */
+	TMap<FName, int32> RecordLevels;
+
+	/**
+	 * Finds or Adds the Persistent Record of an Interaction, Counting it Towards its Level
+	 */
+	FInteractionRecord& FindOrAddInteractionRecord(FName PersistentId);
+
+	/**
+	 * Removes the Persistent Record of an Interaction
+	 *
+	 * @returns True If a Record Existed
+	 */
+	bool RemoveInteractionRecord(FName PersistentId, FInteractionRecord& OutRecord);
+
+	/**
+	 * Returns the Level Package of a Persistent Id
+	 */
+	static FName GetRecordLevel(FName PersistentId);
+
+	/**
+	 * Rate Limiting State of a Single Connection
+	 */
+	struct FConnectionRequestState
+	{
+		/** Request Token Bucket of the Connection */
+		FInteractionTokenBucket Bucket;
+
+		/** Requests Dropped Since the Last Warning */
+		int32 DroppedSinceLog;
+
+		/** Time of the Last Warning */
+		float LastLogTime;
+
+		/** Latency Histograms of the Connection, Created With the First Sample */
+		TSharedPtr<FInteractionLatencyStages> Latency;
+
+		FConnectionRequestState()
+			:DroppedSinceLog(0)
+			,LastLogTime(0.0f)
+		{}
+	};
+
+	/**
+	 * Notifications Queued for a Single Connection
+	 */
+	struct FConnectionNotificationBatch
+	{
+		/** Actor Carrying the Batch to the Connection */
+		TWeakObjectPtr<AInteractionNotificationBatch> Channel;
+
+		/** Reliable Owner and Terminal Observer Notifications Queued This Frame */
+		TArray<FInteractionNotification> Pending;
+
+		/** Unreliable Intermediate Observer Notifications Queued This Frame */
+		TArray<FInteractionNotification> PendingObservers;
+	};
+
+	/**
+	 * Queues a Notification, Collapsing it Into a Started Notification of the Same Component Queued This Frame
+	 */
+	void QueueNotification(TArray<FInteractionNotification>& Pending, const FInteractionNotification& Notification);
+
+	/**
+	 * Sends the Queued Notifications of Every Connection
+	 */
+	void FlushNotifications();
+
+	/**
+	 * Notification Batches per Client Connection
+	 */
+	TMap<TWeakObjectPtr<UNetConnection>, FConnectionNotificationBatch> NotificationBatches;
+
+	/**
+	 * Prefetches Feedback Assets Entering the Prefetch Radius and Releases Those Leaving the Release Radius
+	 */
+	void UpdateFeedbackPrefetch();
+
+	/**
+	 * Streamable Handles Keeping Prefetched Feedback Assets Resident
+	 */
+	TMap<TWeakObjectPtr<UInteractionComponent>, TSharedPtr<FStreamableHandle>> PrefetchHandles;
+
+	/**
+	 * World Time of the Last Prefetch Update
+	 */
+	float LastPrefetchTime;
+
+	/**
+	 * World Time of the Last Session Prune
+	 */
+	float LastSessionPruneTime;
+
+	/**
+	 * Publishes the Latency Percentiles to Stats and Writes Periodic Dumps
+	 */
+	void UpdateLatencyTelemetry();
+
+	/**
+	 * Global Latency Histograms
+	 */
+	FInteractionLatencyStages LatencyStages;
+
+	/**
+	 * World Time of the Last Periodic Latency Dump
+	 */
+	float LastLatencyDumpTime;
+
+	/**
+	 * Returns the Rate Limiting State of a Connection, Pruning Closed Connections On Creation
+	 */
+	FConnectionRequestState& FindOrAddConnectionState(UNetConnection* Connection);
+
+	/**
+	 * Rate Limiting State per Client Connection
+	 */
+	TMap<TWeakObjectPtr<UNetConnection>, FConnectionRequestState> ConnectionRequestStates;
+
+	/** Total Accepted Server Requests */
+	int32 AcceptedRequestCount;
+
+	/** Total Dropped Server Requests */
+	int32 DroppedRequestCount;
+};
@@ -0,0 +1,459 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "InteractionAuditCommandlet.h"
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "Engine/LevelStreaming.h"
+#include "GameFramework/Actor.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "AssetRegistryModule.h"
+#include "InteractionComponents/InteractionComponent.h"
+#include "InteractionComponents/InteractionComponent_Hold.h"
+#include "InteractionComponents/InteractionComponent_Instanced.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogInteractionAudit, Log, All);
+
+namespace InteractionAudit
+{
+	/** Estimated Bytes of a Single Observer Notification: Component and Interactor Net GUIDs, Result and Sequence */
+	constexpr int32 NotificationBytes = 12;
+
+	/**
+	 * Interactables of a Grid Cell
+	 */
+	struct FCell
+	{
+		int32 Count = 0;
+		int32 MulticastCount = 0;
+	};
+
+	/**
+	 * Component With an Expensive Setting
+	 */
+	struct FFinding
+	{
+		FString Actor;
+		FString Component;
+		FString Issue;
+	};
+
+	/**
+	 * Interaction Placed in a Cell, Kept for the Dense Area Pass
+	 */
+	struct FPlacement
+	{
+		FIntPoint Cell;
+		const UInteractionComponent* Component;
+	};
+
+	/**
+	 * Audit Results of a Single Map
+	 */
+	struct FMapAudit
+	{
+		FString MapName;
+		int32 Actors = 0;
+		int32 Components = 0;
+		int32 HoldComponents = 0;
+		int32 InstancedComponents = 0;
+		int32 Items = 0;
+		int32 MulticastComponents = 0;
+		int32 FaceOnlyComponents = 0;
+		int32 MultiComponentActors = 0;
+		int32 ProxyComponents = 0;
+		int32 PeakCellDensity = 0;
+		int32 PeakCellMulticast = 0;
+		float AverageCellDensity = 0.0f;
+		TMap<FIntPoint, FCell> Cells;
+		TArray<FPlacement> Placements;
+		TArray<FFinding> Findings;
+	};
+
+	/**
+	 * Returns the World Transform of a Component From its Serialized Attachment Chain, Valid Without Registering the Component
+	 */
+	FTransform GetSerializedWorldTransform(const USceneComponent* Component)
+	{
+		FTransform Transform = FTransform::Identity;
+
+		for (const USceneComponent* Each = Component; Each != nullptr; Each = Each->GetAttachParent())
+		{
+			Transform = Transform * Each->GetRelativeTransform();
+		}
+
+		return Transform;
+	}
+
+	/**
+	 * Returns the Instanced Mesh an Instanced Interaction Handles
+	 */
+	const UInstancedStaticMeshComponent* FindInstancedMesh(const UInteractionComponent_Instanced* InteractionComponent)
+	{
+		TInlineComponentArray<UInstancedStaticMeshComponent*> InstancedMeshes(InteractionComponent->GetOwner());
+
+		for (const UInstancedStaticMeshComponent* InstancedMesh : InstancedMeshes)
+		{
+			if (InteractionComponent->InstancedMeshName.IsNone() || InstancedMesh->GetFName() == InteractionComponent->InstancedMeshName)
+			{
+				return InstancedMesh;
+			}
+		}
+
+		return nullptr;
+	}
+
+	/**
+	 * Adds an Interaction Location to the Grid
+	 */
+	void AddPlacement(FMapAudit& Audit, const UInteractionComponent* Component, const FVector& Location, float CellSize)
+	{
+		const FIntPoint Cell(FMath::FloorToInt(Location.X / CellSize), FMath::FloorToInt(Location.Y / CellSize));
+
+		FCell& GridCell = Audit.Cells.FindOrAdd(Cell);
+		++GridCell.Count;
+
+		if (Component->GetStateNetMode() == EInteractionNetMode::INM_All)
+		{
+			++GridCell.MulticastCount;
+		}
+
+		Audit.Placements.Add({ Cell, Component });
+	}
+
+	/**
+	 * Audits the Actors of a Level
+	 */
+	void AuditLevel(FMapAudit& Audit, const ULevel* Level, const FTransform& LevelTransform, float CellSize)
+	{
+		for (const AActor* Actor : Level->Actors)
+		{
+			if (!IsValid(Actor))
+			{
+				continue;
+			}
+
+			TInlineComponentArray<UInteractionComponent*> InteractionComponents(Actor);
+			if (InteractionComponents.Num() == 0)
+			{
+				continue;
+			}
+
+			++Audit.Actors;
+
+			if (InteractionComponents.Num() > 1)
+			{
+				++Audit.MultiComponentActors;
+				Audit.Findings.Add({ Actor->GetName(), FString(), FString::Printf(TEXT("%d Interaction Components on One Actor"), InteractionComponents.Num()) });
+			}
+
+			for (const UInteractionComponent* InteractionComponent : InteractionComponents)
+			{
+				++Audit.Components;
+
+				Audit.HoldComponents += InteractionComponent->IsA<UInteractionComponent_Hold>() ? 1 : 0;
+				Audit.MulticastComponents += InteractionComponent->GetStateNetMode() == EInteractionNetMode::INM_All ? 1 : 0;
+				Audit.FaceOnlyComponents += InteractionComponent->RequiresFaceInteraction() ? 1 : 0;
+				Audit.ProxyComponents += InteractionComponent->ProxyShape != EInteractionProxyShape::IPS_None && InteractionComponent->ProxyShape != EInteractionProxyShape::IPS_Owner ? 1 : 0;
+
+				const FTransform ComponentTransform = GetSerializedWorldTransform(InteractionComponent) * LevelTransform;
+
+				/* Every Instance of an Instanced Interaction is an Interactable */
+				const UInteractionComponent_Instanced* InstancedComponent = Cast<UInteractionComponent_Instanced>(InteractionComponent);
+				const UInstancedStaticMeshComponent* InstancedMesh = InstancedComponent != nullptr ? FindInstancedMesh(InstancedComponent) : nullptr;
+
+				if (InstancedComponent != nullptr)
+				{
+					++Audit.InstancedComponents;
+				}
+
+				if (InstancedMesh != nullptr)
+				{
+					const FTransform MeshTransform = GetSerializedWorldTransform(InstancedMesh) * LevelTransform;
+
+					for (int32 Index = 0; Index < InstancedMesh->GetInstanceCount(); ++Index)
+					{
+						FTransform InstanceTransform;
+						InstancedMesh->GetInstanceTransform(Index, InstanceTransform, false);
+
+						AddPlacement(Audit, InteractionComponent, (InstanceTransform * MeshTransform).GetLocation(), CellSize);
+					}
+
+					Audit.Items += InstancedMesh->GetInstanceCount();
+				}
+				else
+				{
+					AddPlacement(Audit, InteractionComponent, ComponentTransform.GetLocation(), CellSize);
+
+					++Audit.Items;
+				}
+			}
+		}
+	}
+
+	/**
+	 * Computes the Cell Metrics and Flags Expensive Settings in Dense Cells
+	 */
+	void FinalizeAudit(FMapAudit& Audit, int32 DenseCellThreshold)
+	{
+		int32 TotalCount = 0;
+
+		for (const TPair<FIntPoint, FCell>& Cell : Audit.Cells)
+		{
+			Audit.PeakCellDensity = FMath::Max(Audit.PeakCellDensity, Cell.Value.Count);
+			Audit.PeakCellMulticast = FMath::Max(Audit.PeakCellMulticast, Cell.Value.MulticastCount);
+			TotalCount += Cell.Value.Count;
+		}
+
+		Audit.AverageCellDensity = Audit.Cells.Num() > 0 ? static_cast<float>(TotalCount) / Audit.Cells.Num() : 0.0f;
+
+		/* Face Only Interactions Multicasting in Dense Areas Pay Direction Checks and Observer Traffic Together */
+		TSet<const UInteractionComponent*> Flagged;
+
+		for (const FPlacement& Placement : Audit.Placements)
+		{
+			const FCell& Cell = Audit.Cells.FindChecked(Placement.Cell);
+
+			if (Cell.Count >= DenseCellThreshold &&
+				Placement.Component->RequiresFaceInteraction() &&
+				Placement.Component->GetStateNetMode() == EInteractionNetMode::INM_All &&
+				!Flagged.Contains(Placement.Component))
+			{
+				Flagged.Add(Placement.Component);
+				Audit.Findings.Add({ Placement.Component->GetOwner()->GetName(), Placement.Component->GetName(), FString::Printf(TEXT("Face Only With Net Mode All in a Cell of %d Interactables"), Cell.Count) });
+			}
+		}
+
+		Audit.Placements.Empty();
+	}
+
+	/**
+	 * Returns the Long Package Name of a Map, Searching the Content Directories for Short Names
+	 */
+	FString ResolveMapName(const FString& MapName)
+	{
+		if (FPackageName::IsValidLongPackageName(MapName))
+		{
+			return MapName;
+		}
+
+		FString LongPackageName;
+		return FPackageName::SearchForPackageOnDisk(MapName, &LongPackageName) ? LongPackageName : FString();
+	}
+}
+
+UInteractionAuditCommandlet::UInteractionAuditCommandlet()
+	:CellSize(2000.0f)
+	,DenseCellThreshold(16)
+	,MaxInteractions(0)
+	,MaxCellDensity(0)
+	,MaxCellMulticast(0)
+{
+	IsClient = false;
+	IsServer = false;
+	IsEditor = true;
+	LogToConsole = true;
+}
+
+int32 UInteractionAuditCommandlet::Main(const FString& Params)
+{
+	using namespace InteractionAudit;
+
+	/* Command Line Overrides of the Config */
+	FParse::Value(*Params, TEXT("CellSize="), CellSize);
+	FParse::Value(*Params, TEXT("DenseCell="), DenseCellThreshold);
+	FParse::Value(*Params, TEXT("MaxInteractions="), MaxInteractions);
+	FParse::Value(*Params, TEXT("MaxCellDensity="), MaxCellDensity);
+	FParse::Value(*Params, TEXT("MaxCellMulticast="), MaxCellMulticast);
+
+	CellSize = FMath::Max(CellSize, 1.0f);
+
+	FString OutputDir = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Interaction"));
+	FParse::Value(*Params, TEXT("Output="), OutputDir);
+
+	/* Gather the Maps */
+	TArray<FString> MapNames;
+
+	FString MapsValue;
+	if (FParse::Value(*Params, TEXT("Maps="), MapsValue, false))
+	{
+		MapsValue.ParseIntoArray(MapNames, TEXT("+"));
+	}
+
+	if (FParse::Param(*Params, TEXT("AllMaps")))
+	{
+		IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>(TEXT("AssetRegistry")).Get();
+		AssetRegistry.SearchAllAssets(true);
+
+		TArray<FAssetData> WorldAssets;
+		AssetRegistry.GetAssetsByClass(UWorld::StaticClass()->GetFName(), WorldAssets);
+
+		for (const FAssetData& WorldAsset : WorldAssets)
+		{
+			if (WorldAsset.PackageName.ToString().StartsWith(TEXT("/Game/")))
+			{
+				MapNames.AddUnique(WorldAsset.PackageName.ToString());
+			}
+		}
+	}
+
+	if (MapNames.Num() == 0)
+	{
+		UE_LOG(LogInteractionAudit, Error, TEXT("No Maps to Audit, Use -Maps=/Game/Map+/Game/Other or -AllMaps"));
+		return 1;
+	}
+
+	TArray<FMapAudit> Audits;
+
+	for (const FString& MapName : MapNames)
+	{
+		const FString PackageName = ResolveMapName(MapName);
+		UPackage* Package = PackageName.IsEmpty() ? nullptr : LoadPackage(nullptr, *PackageName, LOAD_None);
+		UWorld* World = Package != nullptr ? UWorld::FindWorldInPackage(Package) : nullptr;
+
+		if (World == nullptr || World->PersistentLevel == nullptr)
+		{
+			UE_LOG(LogInteractionAudit, Error, TEXT("Unable to Load Map %s"), *MapName);
+			continue;
+		}
+
+		FMapAudit& Audit = Audits.AddDefaulted_GetRef();
+		Audit.MapName = PackageName;
+
+		AuditLevel(Audit, World->PersistentLevel, FTransform::Identity, CellSize);
+
+		/* Streaming Levels are Audited at their Level Transform */
+		for (const ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+		{
+			if (StreamingLevel == nullptr)
+			{
+				continue;
+			}
+
+			UPackage* LevelPackage = LoadPackage(nullptr, *StreamingLevel->GetWorldAssetPackageName(), LOAD_None);
+			const UWorld* LevelWorld = LevelPackage != nullptr ? UWorld::FindWorldInPackage(LevelPackage) : nullptr;
+
+			if (LevelWorld != nullptr && LevelWorld->PersistentLevel != nullptr)
+			{
+				AuditLevel(Audit, LevelWorld->PersistentLevel, StreamingLevel->LevelTransform, CellSize);
+			}
+		}
+
+		FinalizeAudit(Audit, DenseCellThreshold);
+
+		UE_LOG(LogInteractionAudit, Display, TEXT("%s: %d Interactables in %d Components, Peak Cell %d, Peak Multicast Cell %d, %d Findings"),
+			*Audit.MapName, Audit.Items, Audit.Components, Audit.PeakCellDensity, Audit.PeakCellMulticast, Audit.Findings.Num());
+
+		/* Release the Map Before Loading the Next One */
+		CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+	}
+
+	/* Write the Reports */
+	FString Csv = TEXT("Map,Actors,Components,Hold,Instanced,Interactables,Multicast,FaceOnly,MultiComponentActors,Proxies,Cells,AverageCellDensity,PeakCellDensity,PeakCellMulticast,EstTraceCandidates,EstMulticastBytesPerFrame,Findings\n");
+	FString CellsCsv = TEXT("Map,CellX,CellY,Interactables,Multicast\n");
+	FString Json;
+	TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+	JsonWriter->WriteArrayStart();
+
+	bool bWithinBudget = true;
+
+	for (const FMapAudit& Audit : Audits)
+	{
+		/* An Interactor in the Densest Cell Tests its Interactables, an Observer There Receives their Notifications When All Fire Together */
+		const int32 EstTraceCandidates = Audit.PeakCellDensity;
+		const int32 EstMulticastBytes = Audit.PeakCellMulticast * NotificationBytes;
+
+		Csv += FString::Printf(TEXT("%s,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d,%.2f,%d,%d,%d,%d,%d\n"),
+			*Audit.MapName, Audit.Actors, Audit.Components, Audit.HoldComponents, Audit.InstancedComponents, Audit.Items,
+			Audit.MulticastComponents, Audit.FaceOnlyComponents, Audit.MultiComponentActors, Audit.ProxyComponents, Audit.Cells.Num(),
+			Audit.AverageCellDensity, Audit.PeakCellDensity, Audit.PeakCellMulticast, EstTraceCandidates, EstMulticastBytes, Audit.Findings.Num());
+
+		JsonWriter->WriteObjectStart();
+		JsonWriter->WriteValue(TEXT("map"), Audit.MapName);
+		JsonWriter->WriteValue(TEXT("actors"), Audit.Actors);
+		JsonWriter->WriteValue(TEXT("components"), Audit.Components);
+		JsonWriter->WriteValue(TEXT("hold"), Audit.HoldComponents);
+		JsonWriter->WriteValue(TEXT("instanced"), Audit.InstancedComponents);
+		JsonWriter->WriteValue(TEXT("interactables"), Audit.Items);
+		JsonWriter->WriteValue(TEXT("multicast"), Audit.MulticastComponents);
+		JsonWriter->WriteValue(TEXT("faceOnly"), Audit.FaceOnlyComponents);
+		JsonWriter->WriteValue(TEXT("multiComponentActors"), Audit.MultiComponentActors);
+		JsonWriter->WriteValue(TEXT("proxies"), Audit.ProxyComponents);
+		JsonWriter->WriteValue(TEXT("averageCellDensity"), Audit.AverageCellDensity);
+		JsonWriter->WriteValue(TEXT("peakCellDensity"), Audit.PeakCellDensity);
+		JsonWriter->WriteValue(TEXT("peakCellMulticast"), Audit.PeakCellMulticast);
+		JsonWriter->WriteValue(TEXT("estTraceCandidates"), EstTraceCandidates);
+		JsonWriter->WriteValue(TEXT("estMulticastBytesPerFrame"), EstMulticastBytes);
+
+		JsonWriter->WriteArrayStart(TEXT("cells"));
+		for (const TPair<FIntPoint, FCell>& Cell : Audit.Cells)
+		{
+			CellsCsv += FString::Printf(TEXT("%s,%d,%d,%d,%d\n"), *Audit.MapName, Cell.Key.X, Cell.Key.Y, Cell.Value.Count, Cell.Value.MulticastCount);
+
+			JsonWriter->WriteObjectStart();
+			JsonWriter->WriteValue(TEXT("x"), Cell.Key.X);
+			JsonWriter->WriteValue(TEXT("y"), Cell.Key.Y);
+			JsonWriter->WriteValue(TEXT("count"), Cell.Value.Count);
+			JsonWriter->WriteValue(TEXT("multicast"), Cell.Value.MulticastCount);
+			JsonWriter->WriteObjectEnd();
+		}
+		JsonWriter->WriteArrayEnd();
+
+		/* Actor and Component Names are Escaped by the Writer */
+		JsonWriter->WriteArrayStart(TEXT("findings"));
+		for (const FFinding& Finding : Audit.Findings)
+		{
+			JsonWriter->WriteObjectStart();
+			JsonWriter->WriteValue(TEXT("actor"), Finding.Actor);
+			JsonWriter->WriteValue(TEXT("component"), Finding.Component);
+			JsonWriter->WriteValue(TEXT("issue"), Finding.Issue);
+			JsonWriter->WriteObjectEnd();
+		}
+		JsonWriter->WriteArrayEnd();
+
+		JsonWriter->WriteObjectEnd();
+
+		/* Budgets */
+		if (MaxInteractions > 0 && Audit.Items > MaxInteractions)
+		{
+			UE_LOG(LogInteractionAudit, Error, TEXT("%s Exceeds the Interaction Budget: %d of %d"), *Audit.MapName, Audit.Items, MaxInteractions);
+			bWithinBudget = false;
+		}
+
+		if (MaxCellDensity > 0 && Audit.PeakCellDensity > MaxCellDensity)
+		{
+			UE_LOG(LogInteractionAudit, Error, TEXT("%s Exceeds the Cell Density Budget: %d of %d"), *Audit.MapName, Audit.PeakCellDensity, MaxCellDensity);
+			bWithinBudget = false;
+		}
+
+		if (MaxCellMulticast > 0 && Audit.PeakCellMulticast > MaxCellMulticast)
+		{
+			UE_LOG(LogInteractionAudit, Error, TEXT("%s Exceeds the Cell Multicast Budget: %d of %d"), *Audit.MapName, Audit.PeakCellMulticast, MaxCellMulticast);
+			bWithinBudget = false;
+		}
+	}
+
+	JsonWriter->WriteArrayEnd();
+	JsonWriter->Close();
+
+	const FString CsvPath = FPaths::Combine(OutputDir, TEXT("InteractionAudit.csv"));
+	const FString CellsCsvPath = FPaths::Combine(OutputDir, TEXT("InteractionAuditCells.csv"));
+	const FString JsonPath = FPaths::Combine(OutputDir, TEXT("InteractionAudit.json"));
+
+	if (!FFileHelper::SaveStringToFile(Csv, *CsvPath) ||
+		!FFileHelper::SaveStringToFile(CellsCsv, *CellsCsvPath) ||
+		!FFileHelper::SaveStringToFile(Json, *JsonPath))
+	{
+		UE_LOG(LogInteractionAudit, Error, TEXT("Unable to Write the Interaction Audit to %s"), *OutputDir);
+		return 1;
+	}
+
+	UE_LOG(LogInteractionAudit, Display, TEXT("Interaction Audit of %d Maps Written to %s"), Audits.Num(), *OutputDir);
+
+	return bWithinBudget && Audits.Num() == MapNames.Num() ? 0 : 1;
+}
@@ -0,0 +1,55 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "InteractionAuditCommandlet.generated.h"
+
+/**
+ * Headless Audit of the Interaction Cost of Maps
+ *
+ * Loads Each Map and its Streaming Levels Without Initializing a World and Reports:
+ * Interaction Counts per Type, Densities per Grid Cell, Components With Expensive Settings and an Estimated per Frame Trace/Replication Cost
+ * Results are Written as CSV and JSON, the Commandlet Returns 1 When a Budget is Exceeded so it Can Gate Cooks
+ *
+ * Usage:
+ * UnrealEditor-Cmd <Project> -run=InteractionAudit -Maps=/Game/Maps/A+/Game/Maps/B [-AllMaps] [-CellSize=2000] [-DenseCell=16] [-Output=<Dir>]
+ * Grid and Budgets Default to the Config and Can be Overridden: -CellSize= -DenseCell= -MaxInteractions= -MaxCellDensity= -MaxCellMulticast=
+ */
+UCLASS(config = Game)
+class INTERACTIONPLUGINEDITOR_API UInteractionAuditCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+
+	UInteractionAuditCommandlet();
+
+	/** UCommandlet Implementation */
+	int32 Main(const FString& Params) override;
+
+	/**
+	 * [Config] Size in Units of the 2D Grid Cells Densities are Measured In
+	 */
+	UPROPERTY(config)
+		float CellSize;
+
+	/**
+	 * [Config] Interactables per Cell From Which an Area is Considered Dense
+	 */
+	UPROPERTY(config)
+		int32 DenseCellThreshold;
+
+	/**
+	 * [Config] Budgets Checked per Map, Zero or Less Disables a Budget
+	 */
+	UPROPERTY(config)
+		int32 MaxInteractions;
+
+	UPROPERTY(config)
+		int32 MaxCellDensity;
+
+	UPROPERTY(config)
+		int32 MaxCellMulticast;
+};
@@ -0,0 +1,220 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "InteractionReplicationGraphNode.h"
+#include "GameFramework/Actor.h"
+#include "InteractionComponents/InteractionComponent.h"
+#include "Subsystems/InteractionSubsystem.h"
+#include "Engine/World.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogInteractionReplicationGraph, Log, All);
+
+UReplicationGraphNode_Interaction::UReplicationGraphNode_Interaction()
+	:CellSize(2000.0f)
+	,RelevancyDistance(3000.0f)
+	,ActiveReplicationPeriodFrame(1)
+	,DistancePriorityScale(0.5f)
+	,PreparedFrames(0)
+{
+	/* Movable Actors are Re-Bucketed and Active Actors Force Updated Before Each Gather */
+	bRequiresPrepareForReplicationCall = true;
+}
+
+bool UReplicationGraphNode_Interaction::IsInteractableActor(const AActor* Actor)
+{
+	return IsValid(Actor) && Actor->FindComponentByClass<UInteractionComponent>() != nullptr;
+}
+
+void UReplicationGraphNode_Interaction::InitClassReplicationInfo(UClass* ActorClass) const
+{
+	if (ActorClass == nullptr || !GraphGlobals.IsValid() || GraphGlobals->GlobalActorReplicationInfoMap == nullptr)
+	{
+		return;
+	}
+
+	/* Start From the Class Settings Already Configured by the Project Graph */
+	FClassReplicationInfo ClassInfo = GraphGlobals->GlobalActorReplicationInfoMap->GetClassInfo(ActorClass);
+	ClassInfo.DistancePriorityScale = DistancePriorityScale;
+
+	/* Cells Only Narrow the Gather, the Cull Distance Bounds Relevancy to the Exact Distance */
+	ClassInfo.SetCullDistanceSquared(FMath::Square(RelevancyDistance));
+
+	GraphGlobals->GlobalActorReplicationInfoMap->SetClassInfo(ActorClass, ClassInfo);
+}
+
+FIntPoint UReplicationGraphNode_Interaction::GetCell(const FVector& Location) const
+{
+	return FIntPoint(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize)
+	);
+}
+
+void UReplicationGraphNode_Interaction::AddToCell(AActor* Actor, const FIntPoint& Cell)
+{
+	FActorRepListRefView* CellList = Cells.Find(Cell);
+	if (CellList == nullptr)
+	{
+		CellList = &Cells.Add(Cell);
+		CellList->Reset();
+	}
+
+	CellList->Add(Actor);
+}
+
+void UReplicationGraphNode_Interaction::RemoveFromCell(AActor* Actor, const FIntPoint& Cell)
+{
+	FActorRepListRefView* CellList = Cells.Find(Cell);
+	if (CellList != nullptr)
+	{
+		CellList->RemoveFast(Actor);
+
+		if (CellList->Num() == 0)
+		{
+			Cells.Remove(Cell);
+		}
+	}
+}
+
+void UReplicationGraphNode_Interaction::NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo)
+{
+	AActor* Actor = ActorInfo.Actor;
+	if (!IsValid(Actor) || Entries.Contains(Actor))
+	{
+		return;
+	}
+
+	const USceneComponent* RootComponent = Actor->GetRootComponent();
+
+	FInteractableActorEntry Entry;
+	Entry.InteractionComponent = Actor->FindComponentByClass<UInteractionComponent>();
+	Entry.Cell = GetCell(Actor->GetActorLocation());
+	Entry.bMovable = RootComponent == nullptr || RootComponent->Mobility == EComponentMobility::Movable;
+
+	AddToCell(Actor, Entry.Cell);
+	Entries.Add(Actor, Entry);
+
+	if (Entry.bMovable)
+	{
+		MovableActors.Add(Actor);
+	}
+}
+
+bool UReplicationGraphNode_Interaction::NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound)
+{
+	AActor* Actor = ActorInfo.Actor;
+
+	FInteractableActorEntry Entry;
+	if (!Entries.RemoveAndCopyValue(Actor, Entry))
+	{
+		if (bWarnIfNotFound)
+		{
+			UE_LOG(LogInteractionReplicationGraph, Warning, TEXT("Interaction Replication Node Could Not Remove Untracked Actor %s"), *GetNameSafe(Actor));
+		}
+
+		return false;
+	}
+
+	RemoveFromCell(Actor, Entry.Cell);
+	MovableActors.Remove(Actor);
+
+	return true;
+}
+
+void UReplicationGraphNode_Interaction::NotifyResetAllNetworkActors()
+{
+	Cells.Empty();
+	Entries.Empty();
+	MovableActors.Empty();
+}
+
+void UReplicationGraphNode_Interaction::PrepareForReplication()
+{
+	/* Re-Bucket Movable Actors that Moved Into Another Cell */
+	for (AActor* Actor : MovableActors)
+	{
+		FInteractableActorEntry* Entry = Entries.Find(Actor);
+
+		if (Entry == nullptr || !IsValid(Actor))
+		{
+			continue;
+		}
+
+		const FIntPoint NewCell = GetCell(Actor->GetActorLocation());
+
+		if (NewCell != Entry->Cell)
+		{
+			RemoveFromCell(Actor, Entry->Cell);
+			AddToCell(Actor, NewCell);
+			Entry->Cell = NewCell;
+		}
+	}
+
+	const bool bUpdateActive = ActiveReplicationPeriodFrame <= 1 || (PreparedFrames++ % ActiveReplicationPeriodFrame) == 0;
+
+	UWorld* World = GraphGlobals.IsValid() ? GraphGlobals->World : nullptr;
+	const UInteractionSubsystem* InteractionSubsystem = bUpdateActive && IsValid(World) ? World->GetSubsystem<UInteractionSubsystem>() : nullptr;
+
+	if (!IsValid(InteractionSubsystem))
+	{
+		return;
+	}
+
+	/* Force Update Actors While Any Interactor Is Interacting, Visiting the Sessions In Progress Only */
+	TSet<AActor*, DefaultKeyFuncs<AActor*>, TInlineSetAllocator<16>> UpdatedActors;
+
+	InteractionSubsystem->GetSessions().ForEach([this, &UpdatedActors](FInteractionHandle Handle, const FInteractionSession& Session)
+	{
+		const UInteractionComponent* InteractionComponent = Session.Interaction.Get();
+		AActor* Actor = InteractionComponent != nullptr ? InteractionComponent->GetOwner() : nullptr;
+
+		bool bAlreadyUpdated = false;
+		UpdatedActors.Add(Actor, &bAlreadyUpdated);
+
+		if (!bAlreadyUpdated && IsValid(Actor) && Entries.Contains(Actor))
+		{
+			Actor->ForceNetUpdate();
+		}
+	});
+}
+
+void UReplicationGraphNode_Interaction::GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params)
+{
+	/* Number of Cells Around the Viewer Covering the Relevancy Distance */
+	const int32 CellRadius = FMath::CeilToInt(RelevancyDistance / CellSize);
+
+	TArray<FIntPoint, TInlineAllocator<32>> GatheredCells;
+
+	for (const FNetViewer& Viewer : Params.Viewers)
+	{
+		const FIntPoint ViewerCell = GetCell(Viewer.ViewLocation);
+
+		for (int32 X = ViewerCell.X - CellRadius; X <= ViewerCell.X + CellRadius; ++X)
+		{
+			for (int32 Y = ViewerCell.Y - CellRadius; Y <= ViewerCell.Y + CellRadius; ++Y)
+			{
+				const FIntPoint Cell(X, Y);
+
+				/* Split Screen Viewers May Share Cells */
+				if (GatheredCells.Contains(Cell))
+				{
+					continue;
+				}
+
+				FActorRepListRefView* CellList = Cells.Find(Cell);
+				if (CellList != nullptr && CellList->Num() > 0)
+				{
+					GatheredCells.Add(Cell);
+					Params.OutGatheredReplicationLists.AddReplicationActorList(*CellList);
+				}
+			}
+		}
+	}
+}
+
+void UReplicationGraphNode_Interaction::LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const
+{
+	DebugInfo.Log(NodeName);
+	DebugInfo.PushIndent();
+	DebugInfo.Log(FString::Printf(TEXT("Interactable Actors: %d  Cells: %d"), Entries.Num(), Cells.Num()));
+	DebugInfo.PopIndent();
+}
@@ -0,0 +1,120 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ReplicationGraph.h"
+#include "InteractionReplicationGraphNode.generated.h"
+
+class UInteractionComponent;
+
+/**
+ * Replication Graph Node Routing Interactable Actors Only to Connections Within Interaction Relevant Distance
+ *
+ * Interactable Actors are Bucketed in a 2D Grid and Each Connection Gathers the Cells Around its Viewers.
+ * Replication Settings are Applied per Interactable Class, Actors With a Session In Progress are Force Updated.
+ *
+ * @note Route Actors to this Node From the Project Replication Graph, @see IsInteractableActor, InitClassReplicationInfo
+ */
+UCLASS()
+class INTERACTIONREPLICATIONGRAPH_API UReplicationGraphNode_Interaction : public UReplicationGraphNode
+{
+	GENERATED_BODY()
+
+public:
+
+	UReplicationGraphNode_Interaction();
+
+	/**
+	 * [Config] Size of a Grid Cell in Unreal Units
+	 */
+	float CellSize;
+
+	/**
+	 * [Config] Distance From a Viewer Within Which Interactable Actors are Relevant
+	 */
+	float RelevancyDistance;
+
+	/**
+	 * [Config] Period in Frames at Which Actors With an Active Interaction are Force Updated
+	 */
+	uint16 ActiveReplicationPeriodFrame;
+
+	/**
+	 * [Config] Distance Priority Scale Applied to Interactable Classes, Lower is More Important
+	 */
+	float DistancePriorityScale;
+
+	/**
+	 * Returns True If the Actor Has an Interaction Component and Should be Routed to this Node
+	 */
+	static bool IsInteractableActor(const AActor* Actor);
+
+	/**
+	 * Applies the Interactable Distance Priority and Cull Distance to an Actor Class
+	 *
+	 * @param ActorClass - Interactable Actor Class
+	 * @note Call From InitGlobalGraphNodes After Creating the Node, Before Actors of the Class are Added
+	 */
+	void InitClassReplicationInfo(UClass* ActorClass) const;
+
+	void NotifyAddNetworkActor(const FNewReplicatedActorInfo& ActorInfo) override;
+
+	bool NotifyRemoveNetworkActor(const FNewReplicatedActorInfo& ActorInfo, bool bWarnIfNotFound = true) override;
+
+	void NotifyResetAllNetworkActors() override;
+
+	void PrepareForReplication() override;
+
+	void GatherActorListsForConnection(const FConnectionGatherActorListParameters& Params) override;
+
+	void LogNode(FReplicationGraphDebugInfo& DebugInfo, const FString& NodeName) const override;
+
+private:
+
+	/**
+	 * Tracking Data of a Single Interactable Actor
+	 */
+	struct FInteractableActorEntry
+	{
+		/** Interaction Component of the Actor */
+		TWeakObjectPtr<UInteractionComponent> InteractionComponent;
+
+		/** Grid Cell the Actor is Currently Bucketed In */
+		FIntPoint Cell;
+
+		/** Whether the Actor Can Move and Needs its Cell Updated */
+		bool bMovable;
+	};
+
+	/**
+	 * Returns the Grid Cell of a Location
+	 */
+	FIntPoint GetCell(const FVector& Location) const;
+
+	/**
+	 * Adds or Removes an Actor From the Cell Lists
+	 */
+	void AddToCell(AActor* Actor, const FIntPoint& Cell);
+	void RemoveFromCell(AActor* Actor, const FIntPoint& Cell);
+
+	/**
+	 * Interactable Actors per Grid Cell
+	 */
+	TMap<FIntPoint, FActorRepListRefView> Cells;
+
+	/**
+	 * Tracking Data of All Interactable Actors Routed to this Node
+	 */
+	TMap<AActor*, FInteractableActorEntry> Entries;
+
+	/**
+	 * Interactable Actors With a Movable Root, the Only Ones Re-Bucketed Each Frame
+	 */
+	TSet<AActor*> MovableActors;
+
+	/**
+	 * Number of Frames Prepared by this Node, Used to Pace Active Actor Updates
+	 */
+	uint32 PreparedFrames;
+};